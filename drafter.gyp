@@ -225,6 +225,10 @@
       'type': '<(libdrafter_type)',
       "conditions" : [
         [ 'libdrafter_type=="shared_library"', { 'defines' : [ 'DRAFTER_BUILD_SHARED' ] }, { 'defines' : [ 'DRAFTER_BUILD_STATIC' ] }],
+        [ 'drafter_alloc_stats=="true"', {
+          'defines' : [ 'DRAFTER_ALLOC_STATS' ],
+          'direct_dependent_settings' : { 'defines' : [ 'DRAFTER_ALLOC_STATS' ] },
+        }],
       ],
       'direct_dependent_settings' : {
         'include_dirs': [
@@ -243,6 +247,9 @@
         "src/drafter.cc",
         "src/stream.h",
         "src/Version.h",
+        "src/PipelineStats.h",
+        "src/AllocStats.h",
+        "src/AllocStats.cc",
 
         "src/NodeInfo.h",
         "src/Serialize.h",
@@ -292,6 +299,11 @@
         "src/refract/ElementIfc.h",
         "src/refract/Element.h",
         "src/refract/Element.cc",
+        "src/refract/CopyOnWrite.h",
+        "src/refract/CloneStats.h",
+        "src/refract/CloneStats.cc",
+        "src/refract/Symbol.h",
+        "src/refract/Symbol.cc",
         "src/refract/TypeQueryVisitor.h",
         "src/refract/TypeQueryVisitor.cc",
         "src/refract/VisitorUtils.h",
@@ -338,6 +350,7 @@
         "src/refract/dsd/Option.h",
         "src/refract/dsd/Ref.h",
         "src/refract/dsd/Select.h",
+        "src/refract/dsd/SourceMap.h",
         "src/refract/dsd/String.h",
         "src/refract/dsd/Traits.h",
 
@@ -353,6 +366,7 @@
         "src/refract/dsd/Option.cc",
         "src/refract/dsd/Ref.cc",
         "src/refract/dsd/Select.cc",
+        "src/refract/dsd/SourceMap.cc",
         "src/refract/dsd/String.cc",
       ],
       "dependencies": [
@@ -378,6 +392,7 @@
         "test/test-RefractSourceMapTest.cc",
         "test/test-SchemaTest.cc",
         "test/test-CircularReferenceTest.cc",
+        "test/test-NamedTypesRegistry.cc",
         "test/test-ApplyVisitorTest.cc",
         "test/test-ExtendElementTest.cc",
         "test/test-ElementFactoryTest.cc",
@@ -385,6 +400,8 @@
         "test/test-SyntaxIssuesTest.cc",
         "test/test-ElementDataTest.cc",
         "test/test-Serialize.cc",
+        "test/test-ParseManyTest.cc",
+        "test/test-CheckBlueprintTest.cc",
 
         "test/utils/test-Variant.cc",
         "test/utils/test-Utf8.cc",
@@ -394,6 +411,12 @@
         "test/refract/test-Utils.cc",
         "test/refract/test-JsonSchema.cc",
         "test/refract/test-JsonValue.cc",
+        "test/refract/test-SerializeSo.cc",
+        "test/refract/test-Symbol.cc",
+        "test/refract/test-CopyOnWrite.cc",
+        "test/refract/test-CloneStats.cc",
+        "test/refract/test-ExpandVisitor.cc",
+        "test/refract/test-Registry.cc",
 
         "test/refract/dsd/test-Array.cc",
         "test/refract/dsd/test-Bool.cc",
@@ -407,6 +430,7 @@
         "test/refract/dsd/test-Option.cc",
         "test/refract/dsd/test-Ref.cc",
         "test/refract/dsd/test-Select.cc",
+        "test/refract/dsd/test-SourceMap.cc",
         "test/refract/dsd/test-String.cc",
 
         "test/refract/dsd/test-Element.cc",
@@ -441,6 +465,10 @@
         "src/config.h",
         "src/reporting.cc",
         "src/reporting.h",
+        "src/batch.cc",
+        "src/batch.h",
+        "src/input.cc",
+        "src/input.h",
       ],
       "include_dirs": [
         "ext/cmdline",
@@ -450,6 +478,36 @@
       ],
     },
 
+# DRAFTER-BENCH
+    {
+      "target_name": "drafter-bench",
+      "type": "executable",
+      "conditions" : [
+        [ 'libdrafter_type=="static_library"', { 'defines' : [ 'DRAFTER_BUILD_STATIC' ] }],
+      ],
+      "sources": [
+        "test/performance/drafter-bench.cc",
+      ],
+      "dependencies": [
+        "libdrafter",
+      ],
+    },
+
+# INFO ELEMENTS BENCHMARK
+    {
+      "target_name": "info-elements-bench",
+      "type": "executable",
+      "conditions" : [
+        [ 'libdrafter_type=="static_library"', { 'defines' : [ 'DRAFTER_BUILD_STATIC' ] }],
+      ],
+      "sources": [
+        "test/performance/info-elements-bench.cc",
+      ],
+      "dependencies": [
+        "libdrafter",
+      ],
+    },
+
 # DRAFTER C-API TEST
     {
       "target_name": "test-capi",
@@ -10,6 +10,8 @@
 
 using namespace mdp;
 
+const size_t ByteBufferView::npos;
+
 /* Byte lenght of an UTF8 character (based on first byte) */
 #define UTF8_CHAR_LEN(byte) ((0xE5000000 >> ((byte >> 3) & 0x1e)) & 3) + 1
 
@@ -20,7 +22,7 @@ static size_t strnlen_utf8(const char* s, size_t len)
         return 0;
 
     size_t i = 0, j = 0;
-    while (s[i] && i < len) {
+    while (i < len && s[i]) {
         i += UTF8_CHAR_LEN(s[i]);
         j++;
     }
@@ -28,25 +30,27 @@ static size_t strnlen_utf8(const char* s, size_t len)
 }
 
 /* Convert range of bytes to a range of characters */
-static CharactersRange BytesRangeToCharactersRange(const BytesRange& bytesRange, const ByteBuffer& byteBuffer)
+static CharactersRange BytesRangeToCharactersRange(const BytesRange& bytesRange, const ByteBufferView& byteBuffer)
 {
     if (byteBuffer.empty()) {
         return CharactersRange();
     }
 
+    // Accomodate maximum possible length, the buffer need not be NUL-terminated
     BytesRange workRange = bytesRange;
-    if (bytesRange.location + bytesRange.length > byteBuffer.length()) {
-        // Accomodate maximum possible length
-        workRange.length -= bytesRange.location + bytesRange.length - byteBuffer.length();
-    }
+    if (workRange.location > byteBuffer.length())
+        workRange.location = byteBuffer.length();
+
+    if (workRange.location + workRange.length > byteBuffer.length())
+        workRange.length = byteBuffer.length() - workRange.location;
 
     size_t charLocation = 0;
-    if (bytesRange.location > 0)
-        charLocation = strnlen_utf8(byteBuffer.c_str(), bytesRange.location);
+    if (workRange.location > 0)
+        charLocation = strnlen_utf8(byteBuffer.data(), workRange.location);
 
     size_t charLength = 0;
-    if (bytesRange.length > 0)
-        charLength = strnlen_utf8(byteBuffer.c_str() + bytesRange.location, bytesRange.length);
+    if (workRange.length > 0)
+        charLength = strnlen_utf8(byteBuffer.data() + workRange.location, workRange.length);
 
     CharactersRange characterRange = CharactersRange(charLocation, charLength);
     return characterRange;
@@ -85,17 +89,17 @@ static CharactersRange BytesRangeToCharactersRange(const BytesRange& bytesRange,
     return characterRange;
 }
 
-void mdp::BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBuffer& byteBuffer)
+void mdp::BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBufferView& byteBuffer)
 {
 
-    const char* source = byteBuffer.c_str();
+    const char* source = byteBuffer.data();
     size_t len = byteBuffer.length();
     size_t pos = 0;
     size_t charPos = 0;
 
     index.resize(byteBuffer.length());
 
-    while (source[pos] && pos < len) {
+    while (pos < len && source[pos]) {
         int charLen = UTF8_CHAR_LEN(source[pos]);
         pos += charLen;
 
@@ -108,7 +112,8 @@ void mdp::BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBuffer&
     }
 }
 
-CharactersRangeSet mdp::BytesRangeSetToCharactersRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer)
+CharactersRangeSet mdp::BytesRangeSetToCharactersRangeSet(
+    const BytesRangeSet& rangeSet, const ByteBufferView& byteBuffer)
 {
     CharactersRangeSet characterMap;
 
@@ -133,7 +138,7 @@ CharactersRangeSet mdp::BytesRangeSetToCharactersRangeSet(
     return characterMap;
 }
 
-ByteBuffer mdp::MapBytesRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer)
+ByteBuffer mdp::MapBytesRangeSet(const BytesRangeSet& rangeSet, const ByteBufferView& byteBuffer)
 {
     if (byteBuffer.empty())
         return ByteBuffer();
@@ -9,6 +9,7 @@
 #ifndef MARKDOWNPARSER_BYTEBUFFER_H
 #define MARKDOWNPARSER_BYTEBUFFER_H
 
+#include <cstring>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -24,6 +25,83 @@ namespace mdp
      */
     typedef std::string ByteBuffer;
 
+    /**
+     *  \brief Read-only view of source data owned by someone else
+     *
+     *  The viewed bytes have to outlive the view and need not be
+     *  NUL-terminated. Lets the parser work on the caller's data
+     *  without copying it into a ByteBuffer.
+     */
+    class ByteBufferView
+    {
+    public:
+        typedef const char* const_iterator;
+        static const size_t npos = ByteBuffer::npos;
+
+        ByteBufferView() : m_data(""), m_length(0) {}
+        ByteBufferView(const char* data, size_t length) : m_data(length ? data : ""), m_length(length) {}
+        ByteBufferView(const char* data) : m_data(data ? data : ""), m_length(data ? ::strlen(data) : 0) {}
+        ByteBufferView(const ByteBuffer& buffer) : m_data(buffer.data()), m_length(buffer.length()) {}
+
+        const char* data() const
+        {
+            return m_data;
+        }
+
+        size_t length() const
+        {
+            return m_length;
+        }
+
+        size_t size() const
+        {
+            return m_length;
+        }
+
+        bool empty() const
+        {
+            return m_length == 0;
+        }
+
+        const_iterator begin() const
+        {
+            return m_data;
+        }
+
+        const_iterator end() const
+        {
+            return m_data + m_length;
+        }
+
+        char operator[](size_t pos) const
+        {
+            return m_data[pos];
+        }
+
+        /** Position of the first byte c at or after pos, npos if there is none */
+        size_t find(char c, size_t pos = 0) const
+        {
+            if (pos >= m_length)
+                return npos;
+
+            const void* found = ::memchr(m_data + pos, c, m_length - pos);
+            return found ? static_cast<const char*>(found) - m_data : npos;
+        }
+
+        /** Copy of at most count bytes starting at pos */
+        ByteBuffer substr(size_t pos, size_t count = npos) const
+        {
+            if (pos >= m_length)
+                return ByteBuffer();
+
+            return ByteBuffer(m_data + pos, count < m_length - pos ? count : m_length - pos);
+        }
+
+    private:
+        const char* m_data;
+        size_t m_length;
+    };
+
     /** Byte buffer stream */
     typedef std::stringstream ByteBufferStream;
 
@@ -74,15 +152,16 @@ namespace mdp
     typedef std::vector<size_t> ByteBufferCharacterIndex;
 
     /** Fill character map - cache of characters positions */
-    void BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBuffer& byteBuffer);
+    void BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBufferView& byteBuffer);
 
     /** Convert ranges of bytes to ranges of characters */
-    CharactersRangeSet BytesRangeSetToCharactersRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer);
+    CharactersRangeSet BytesRangeSetToCharactersRangeSet(
+        const BytesRangeSet& rangeSet, const ByteBufferView& byteBuffer);
     CharactersRangeSet BytesRangeSetToCharactersRangeSet(
         const BytesRangeSet& rangeSet, const ByteBufferCharacterIndex& index);
 
     /** Maps bytes range set to byte buffer */
-    ByteBuffer MapBytesRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer);
+    ByteBuffer MapBytesRangeSet(const BytesRangeSet& rangeSet, const ByteBufferView& byteBuffer);
 }
 
 #endif
@@ -31,31 +31,43 @@ static ByteBuffer ByteBufferFromSundown(const struct buf* text)
     return ByteBuffer(reinterpret_cast<char*>(text->data), text->size);
 }
 
-MarkdownParser::MarkdownParser() : m_workingNode(NULL), m_listBlockContext(false), m_source(NULL), m_sourceLength(0) {}
+MarkdownParser::MarkdownParser()
+    : m_sundown(NULL), m_output(NULL), m_workingNode(NULL), m_listBlockContext(false)
+{
+}
+
+MarkdownParser::~MarkdownParser()
+{
+    if (m_output)
+        ::bufrelease(m_output);
 
-void MarkdownParser::parse(const ByteBuffer& source, MarkdownNode& ast)
+    if (m_sundown)
+        ::sd_markdown_free(m_sundown);
+}
+
+void MarkdownParser::parse(const ByteBufferView& source, MarkdownNode& ast)
 {
     ast = MarkdownNode();
     m_workingNode = &ast;
     m_workingNode->type = RootMarkdownNodeType;
     m_workingNode->sourceMap.push_back(BytesRange(0, source.length()));
-    m_source = &source;
-    m_sourceLength = source.length();
+    m_source = source;
     m_listBlockContext = false;
 
-    RenderCallbacks callbacks = renderCallbacks();
-
-    ::sd_markdown* sundown = ::sd_markdown_new(ParserExtensions, MaxNesting, &callbacks, renderCallbackData());
-    ::buf* output = ::bufnew(OutputUnitSize);
+    if (!m_sundown) {
+        RenderCallbacks callbacks = renderCallbacks();
+        m_sundown = ::sd_markdown_new(ParserExtensions, MaxNesting, &callbacks, renderCallbackData());
+    }
 
-    ::sd_markdown_render(output, reinterpret_cast<const uint8_t*>(source.c_str()), source.length(), sundown);
+    if (!m_output)
+        m_output = ::bufnew(OutputUnitSize);
 
-    ::bufrelease(output);
-    ::sd_markdown_free(sundown);
+    // Rendered output is discarded, keep the allocation for the next run
+    m_output->size = 0;
+    ::sd_markdown_render(m_output, reinterpret_cast<const uint8_t*>(source.data()), source.length(), m_sundown);
 
     m_workingNode = NULL;
-    m_source = NULL;
-    m_sourceLength = 0;
+    m_source = ByteBufferView();
     m_listBlockContext = false;
 
 #ifdef DEBUG
@@ -345,9 +357,9 @@ void MarkdownParser::blockDidParse(const BytesRangeSet& sourceMap)
     // If new source map would exceed the actual source size
     // this happens when sundown appends an artifical new line
     // truncate the source map length to match the actual size
-    if (sourceMap.back().location + sourceMap.back().length > m_sourceLength) {
+    if (sourceMap.back().location + sourceMap.back().length > m_source.length()) {
 
-        size_t workMapLength = m_sourceLength - sourceMap.back().location;
+        size_t workMapLength = m_source.length() - sourceMap.back().location;
         if (!workMapLength)
             return; // Ignore any artifical trailing new lines in source maps
 
@@ -365,7 +377,7 @@ void MarkdownParser::blockDidParse(const BytesRangeSet& sourceMap)
         && lMarkdownNode.children().front().sourceMap.empty()) {
 
         ByteBuffer& buffer = lMarkdownNode.children().front().text;
-        ByteBuffer mapped = MapBytesRangeSet(sourceMap, *m_source);
+        ByteBuffer mapped = MapBytesRangeSet(sourceMap, m_source);
         size_t pos = mapped.find(buffer);
 
         if (pos != mapped.npos) {
@@ -32,22 +32,31 @@ namespace mdp
     {
     public:
         MarkdownParser();
-        MarkdownParser(const MarkdownParser&);
-        MarkdownParser& operator=(const MarkdownParser&);
+        ~MarkdownParser();
 
         /**
          *  \brief Parse source buffer
          *
-         *  \param source   Markdown source data to be parsed
+         *  The underlying sundown renderer and its output buffer are created
+         *  on first use and reused by subsequent calls. A parser instance
+         *  must not be used from more than one thread at a time.
+         *
+         *  \param source   Markdown source data to be parsed, not copied
          *  \param ast      Parsed AST (root node)
          */
-        void parse(const ByteBuffer& source, MarkdownNode& ast);
+
+        void parse(const ByteBufferView& source, MarkdownNode& ast);
 
     private:
+        MarkdownParser(const MarkdownParser&);
+        MarkdownParser& operator=(const MarkdownParser&);
+
+        ::sd_markdown* m_sundown;
+        ::buf* m_output;
+
         MarkdownNode* m_workingNode;
         bool m_listBlockContext;
-        const ByteBuffer* m_source;
-        size_t m_sourceLength;
+        ByteBufferView m_source; // valid only while parsing
 
         static const size_t OutputUnitSize;
         static const size_t MaxNesting;
@@ -180,3 +180,31 @@ TEST_CASE("Byte buffer and Index should return equal char ranges", "[bytebuffer]
     REQUIRE(charMap[4].location == indexMap[4].location);
     REQUIRE(charMap[4].length == indexMap[4].length);
 }
+
+TEST_CASE("Byte buffer view need not be NUL-terminated", "[bytebuffer][sourcemap]")
+{
+    ByteBuffer src = "19 \xc2\xa2 & 20 \xe2\x82\xac\nTRAILING";
+    ByteBufferView view(src.data(), 15);
+
+    REQUIRE(view.length() == 15);
+    REQUIRE(view.find('\n') == 14);
+    REQUIRE(view.find('T') == ByteBufferView::npos);
+    REQUIRE(view.substr(11) == "\xe2\x82\xac\n");
+
+    ByteBufferCharacterIndex index;
+    mdp::BuildCharacterIndex(index, view);
+    REQUIRE(index.size() == 15);
+
+    BytesRangeSet byteMap;
+    byteMap.push_back(Range(3, 8));
+    byteMap.push_back(Range(11, 30));
+
+    CharactersRangeSet charMap = BytesRangeSetToCharactersRangeSet(byteMap, view);
+    REQUIRE(charMap[0].location == 3);
+    REQUIRE(charMap[0].length == 7);
+    REQUIRE(charMap[1].location == 10);
+    REQUIRE(charMap[1].length == 2);
+
+    byteMap.pop_back();
+    REQUIRE(MapBytesRangeSet(byteMap, view) == "\xc2\xa2 & 20 ");
+}
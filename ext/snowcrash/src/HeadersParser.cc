@@ -16,7 +16,7 @@ typedef std::vector<std::string> HeadersKeyCollection;
 static const HeadersKeyCollection& getAllowedMultipleDefinitions()
 {
 
-    static std::string keys[] = {
+    static const std::string keys[] = {
         HTTPHeaderName::SetCookie,
         HTTPHeaderName::Link,
     };
@@ -232,7 +232,7 @@ namespace snowcrash
             return !header.first.empty();
         }
 
-        static bool fetchLine(const std::string& input, mdp::BytesRange& map, std::string& line)
+        static bool fetchLine(const mdp::ByteBufferView& input, mdp::BytesRange& map, std::string& line)
         {
 
             if (input.length() < (map.location + map.length)) {
@@ -36,7 +36,7 @@ namespace snowcrash
      *  State of the parser.
      */
     struct SectionParserData {
-        SectionParserData(BlueprintParserOptions opts, const mdp::ByteBuffer& src, const Blueprint& bp)
+        SectionParserData(BlueprintParserOptions opts, const mdp::ByteBufferView& src, const Blueprint& bp)
             : options(opts), sourceData(src), blueprint(bp)
         {
         }
@@ -65,8 +65,8 @@ namespace snowcrash
         /** Model Table Sourcemap */
         ModelSourceMapTable modelSourceMapTable;
 
-        /** Source Data */
-        const mdp::ByteBuffer& sourceData;
+        /** Source Data, not owned */
+        const mdp::ByteBufferView sourceData;
 
         /** Source - map of bytes to character position - performance optimization */
         mdp::ByteBufferCharacterIndex sourceCharacterIndex;
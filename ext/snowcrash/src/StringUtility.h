@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <functional>
 #include <cctype>
+#include <iterator>
 #include <locale>
 #include <string>
 #include <sstream>
@@ -57,16 +58,16 @@ namespace snowcrash
         TrimRange;
 
     // Get Trim Info
-    inline TrimRange GetTrimInfo(std::string::const_iterator begin, std::string::const_iterator end)
+    template <typename Iterator>
+    inline TrimRange GetTrimInfo(Iterator begin, Iterator end)
     {
-        std::string::const_reverse_iterator rbegin(end);
-        std::string::const_reverse_iterator rend(begin);
+        std::reverse_iterator<Iterator> rbegin(end);
+        std::reverse_iterator<Iterator> rend(begin);
 
-        std::string::const_iterator trim = std::find_if(begin, end, std::not1(std::ptr_fun(isSpace)));
-        std::string::const_reverse_iterator rtrim = std::find_if(rbegin, rend, std::not1(std::ptr_fun(isSpace)));
+        Iterator trim = std::find_if(begin, end, std::not1(std::ptr_fun(isSpace)));
+        std::reverse_iterator<Iterator> rtrim = std::find_if(rbegin, rend, std::not1(std::ptr_fun(isSpace)));
 
-        return std::make_tuple(
-            std::distance(begin, trim), std::distance(rtrim, std::string::const_reverse_iterator(trim)));
+        return std::make_tuple(std::distance(begin, trim), std::distance(rtrim, std::reverse_iterator<Iterator>(trim)));
     }
 
     // Split string by delim
@@ -8,38 +8,84 @@
 
 #include <regex.h>
 #include <cstring>
+#include <map>
+#include <utility>
 #include "../RegexMatch.h"
 
-// FIXME: Migrate to C++11.
+namespace
+{
+    // Compiled expressions are kept per thread; snowcrash evaluates a small
+    // set of constant expressions over and over, so compiling them once per
+    // thread removes most of the regcomp() cost from parsing.
+    class RegexCache
+    {
+        typedef std::pair<int, std::string> Key;
+        typedef std::map<Key, regex_t> Compiled;
+
+        Compiled compiled;
+
+        // Upper bound on cached expressions, guards against callers
+        // matching against dynamically built expressions
+        static const size_t MaxSize = 256;
+
+        void clear()
+        {
+            for (Compiled::iterator it = compiled.begin(); it != compiled.end(); ++it)
+                ::regfree(&it->second);
+            compiled.clear();
+        }
+
+    public:
+        RegexCache() = default;
+        RegexCache(const RegexCache&) = delete;
+        RegexCache& operator=(const RegexCache&) = delete;
+
+        ~RegexCache()
+        {
+            clear();
+        }
+
+        /// \returns compiled expression or NULL if it does not compile
+        const regex_t* get(const std::string& expression, int flags)
+        {
+            Key key(flags, expression);
+
+            Compiled::iterator it = compiled.find(key);
+            if (it != compiled.end())
+                return &it->second;
+
+            regex_t regex;
+            if (::regcomp(&regex, expression.c_str(), flags))
+                return NULL;
+
+            if (compiled.size() >= MaxSize)
+                clear();
+
+            return &compiled.insert(std::make_pair(key, regex)).first->second;
+        }
+    };
+
+    const regex_t* CompiledRegex(const std::string& expression, int flags)
+    {
+        thread_local RegexCache cache;
+        return cache.get(expression, flags);
+    }
+}
+
 // Naive implementation of regex matching using POSIX regex
 bool snowcrash::RegexMatch(const std::string& target, const std::string& expression)
 {
     if (target.empty() || expression.empty())
         return false;
 
-    regex_t regex;
-    int reti = ::regcomp(&regex, expression.c_str(), REG_EXTENDED | REG_NOSUB);
-    if (reti) {
+    const regex_t* regex = CompiledRegex(expression, REG_EXTENDED | REG_NOSUB);
+    if (!regex) {
         // Unable to compile regex
         return false;
     }
 
     // Execute regular expression
-    reti = ::regexec(&regex, target.c_str(), 0, NULL, 0);
-    if (!reti) {
-        ::regfree(&regex);
-        return true;
-    } else if (reti == REG_NOMATCH) {
-        ::regfree(&regex);
-        return false;
-    } else {
-        char msgbuf[1024];
-        regerror(reti, &regex, msgbuf, sizeof(msgbuf));
-        ::regfree(&regex);
-        return false;
-    }
-
-    return false;
+    return ::regexec(regex, target.c_str(), 0, NULL, 0) == 0;
 }
 
 std::string snowcrash::RegexCaptureFirst(const std::string& target, const std::string& expression)
@@ -60,18 +106,15 @@ bool snowcrash::RegexCapture(
     captureGroups.clear();
 
     try {
-        regex_t regex;
-        int reti = ::regcomp(&regex, expression.c_str(), REG_EXTENDED);
-        if (reti)
+        const regex_t* regex = CompiledRegex(expression, REG_EXTENDED);
+        if (!regex)
             return false;
 
         regmatch_t* pmatch = ::new regmatch_t[groupSize];
         ::memset(pmatch, 0, sizeof(regmatch_t) * groupSize);
 
-        reti = ::regexec(&regex, target.c_str(), groupSize, pmatch, 0);
+        int reti = ::regexec(regex, target.c_str(), groupSize, pmatch, 0);
         if (!reti) {
-            ::regfree(&regex);
-
             for (size_t i = 0; i < groupSize; ++i) {
                 if (pmatch[i].rm_so == -1 || pmatch[i].rm_eo == -1)
                     captureGroups.push_back(std::string());
@@ -82,7 +125,6 @@ bool snowcrash::RegexCapture(
             delete[] pmatch;
             return true;
         } else {
-            ::regfree(&regex);
             delete[] pmatch;
             return false;
         }
@@ -17,12 +17,12 @@ using namespace snowcrash;
  *  \brief  Check source for unsupported character \t & \r
  *  \return True if passed (not found), false otherwise
  */
-static bool CheckSource(const mdp::ByteBuffer& source, Report& report)
+static bool CheckSource(const mdp::ByteBufferView& source, Report& report)
 {
 
-    std::string::size_type pos = source.find("\t");
+    size_t pos = source.find('\t');
 
-    if (pos != std::string::npos) {
+    if (pos != mdp::ByteBufferView::npos) {
 
         mdp::BytesRangeSet rangeSet;
         rangeSet.push_back(mdp::BytesRange(pos, 1));
@@ -32,9 +32,9 @@ static bool CheckSource(const mdp::ByteBuffer& source, Report& report)
         return false;
     }
 
-    pos = source.find("\r");
+    pos = source.find('\r');
 
-    if (pos != std::string::npos) {
+    if (pos != mdp::ByteBufferView::npos) {
 
         mdp::BytesRangeSet rangeSet;
         rangeSet.push_back(mdp::BytesRange(pos, 1));
@@ -49,7 +49,16 @@ static bool CheckSource(const mdp::ByteBuffer& source, Report& report)
 }
 
 int snowcrash::parse(
-    const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out)
+    const mdp::ByteBufferView& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out)
+{
+    mdp::MarkdownParser markdownParser;
+    return parse(source, options, out, markdownParser);
+}
+
+int snowcrash::parse(const mdp::ByteBufferView& source,
+    BlueprintParserOptions options,
+    const ParseResultRef<Blueprint>& out,
+    mdp::MarkdownParser& markdownParser)
 {
     try {
 
@@ -62,7 +71,6 @@ int snowcrash::parse(
             return out.report.error.code;
 
         // Parse Markdown
-        mdp::MarkdownParser markdownParser;
         mdp::MarkdownNode markdownAST;
         markdownParser.parse(source, markdownAST);
 
@@ -32,12 +32,30 @@ namespace snowcrash
     /**
      *  \brief Parse the source data into a blueprint abstract source tree (AST).
      *
-     *  \param source       A textual source data to be parsed.
+     *  \param source       A textual source data to be parsed. It is not copied
+     *                      and has to outlive the call only.
      *  \param options      Parser options. Use 0 for no additional options.
      *  \param out          Output buffer to store parsing result into.
      *  \return Error status code. Zero represents success, non-zero a failure.
      */
-    int parse(const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out);
+    int parse(const mdp::ByteBufferView& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out);
+
+    /**
+     *  \brief Parse the source data using a caller-owned markdown parser.
+     *
+     *  Allows the markdown parser state to be reused across documents.
+     *  The parser must not be shared between threads.
+     *
+     *  \param source           A textual source data to be parsed, not copied.
+     *  \param options          Parser options. Use 0 for no additional options.
+     *  \param out              Output buffer to store parsing result into.
+     *  \param markdownParser   Markdown parser to be used.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parse(const mdp::ByteBufferView& source,
+        BlueprintParserOptions options,
+        const ParseResultRef<Blueprint>& out,
+        mdp::MarkdownParser& markdownParser);
 }
 
 #endif
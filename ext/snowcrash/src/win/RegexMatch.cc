@@ -8,6 +8,7 @@
 
 #include <regex>
 #include <cstring>
+#include <map>
 #include "../RegexMatch.h"
 
 using namespace std;
@@ -19,14 +20,35 @@ using namespace std::tr1;
 // A C++09 implementation
 //
 
+namespace
+{
+    // Per thread cache of compiled expressions, bounded to guard against
+    // callers matching against dynamically built expressions
+    const regex& CompiledRegex(const string& expression)
+    {
+        static const size_t MaxSize = 256;
+        thread_local map<string, regex> cache;
+
+        map<string, regex>::iterator it = cache.find(expression);
+        if (it != cache.end())
+            return it->second;
+
+        regex pattern(expression, regex_constants::extended);
+
+        if (cache.size() >= MaxSize)
+            cache.clear();
+
+        return cache.insert(make_pair(expression, pattern)).first->second;
+    }
+}
+
 bool snowcrash::RegexMatch(const string& target, const string& expression)
 {
     if (target.empty() || expression.empty())
         return false;
 
     try {
-        regex pattern(expression, regex_constants::extended);
-        return regex_search(target, pattern);
+        return regex_search(target, CompiledRegex(expression));
     } catch (const regex_error&) {
     } catch (...) {
     }
@@ -53,9 +75,8 @@ bool snowcrash::RegexCapture(
 
     try {
 
-        regex pattern(expression, regex_constants::extended);
         match_results<string::const_iterator> result;
-        if (!regex_search(target, result, pattern))
+        if (!regex_search(target, result, CompiledRegex(expression)))
             return false;
 
         for (match_results<string::const_iterator>::const_iterator it = result.begin(); it != result.end(); ++it) {
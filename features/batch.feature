@@ -0,0 +1,39 @@
+Feature: Parse blueprints in batch
+
+  Scenario: Parse several blueprint files
+
+    When I run `drafter --batch -j 2 blueprint.apib invalid_blueprint.apib`
+    Then the output should contain:
+    """
+    {"file":"blueprint.apib","code":0,"annotations":0,"result":{"element":"parseResult"
+    """
+    And the output should contain:
+    """
+    {"file":"invalid_blueprint.apib","code":0,"annotations":1,"result":{"element":"parseResult"
+    """
+    And the output should contain:
+    """
+    2 blueprints, 1 OK, 1 with warnings, 0 failed
+    """
+    And the exit status should be 0
+
+  Scenario: Validate a directory of blueprints
+
+    When I run `drafter --batch --validate .`
+    Then the output should contain:
+    """
+    {"file":"./blueprint.apib","code":0,"annotations":0,"result":null}
+    """
+    And the output should contain:
+    """
+    2 blueprints, 1 OK, 1 with warnings, 0 failed
+    """
+
+  Scenario: Report missing file in batch
+
+    When I run `drafter --batch blueprint.apib missing.apib`
+    Then the output should contain:
+    """
+    {"file":"missing.apib","code":-1,"error":"unable to open file"}
+    """
+    And the exit status should be 255
@@ -0,0 +1,154 @@
+//
+//  AllocStats.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#include "AllocStats.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+using namespace drafter;
+
+namespace
+{
+    // plain data only, it is touched from operator new before any
+    // dynamic initialization could take place
+    struct ThreadCounters {
+        size_t allocations;
+        size_t bytes;
+        std::ptrdiff_t live;
+        std::ptrdiff_t peak;
+    };
+
+    thread_local ThreadCounters counters = {};
+}
+
+AllocStats& AllocStats::operator+=(const AllocStats& other) noexcept
+{
+    allocations += other.allocations;
+    bytes += other.bytes;
+    peakBytes = std::max(peakBytes, other.peakBytes);
+
+    return *this;
+}
+
+AllocScope::AllocScope() noexcept
+    : allocations_(counters.allocations), bytes_(counters.bytes), live_(counters.live), peak_(counters.peak)
+{
+    counters.peak = counters.live;
+}
+
+AllocScope::~AllocScope()
+{
+    counters.peak = std::max(counters.peak, peak_);
+}
+
+AllocStats AllocScope::get() const noexcept
+{
+    AllocStats stats;
+
+    stats.allocations = counters.allocations - allocations_;
+    stats.bytes = counters.bytes - bytes_;
+    stats.peakBytes = counters.peak > live_ ? counters.peak - live_ : 0;
+
+    return stats;
+}
+
+#if defined(DRAFTER_ALLOC_STATS)
+
+//
+// Replacement of global allocation functions, every block is prefixed
+// by its size so live bytes can be tracked on release
+//
+
+namespace
+{
+    constexpr size_t HeaderSize = alignof(std::max_align_t);
+
+    void* Allocate(size_t size) noexcept
+    {
+        auto block = static_cast<char*>(std::malloc(size + HeaderSize));
+
+        if (!block)
+            return nullptr;
+
+        *reinterpret_cast<size_t*>(block) = size;
+
+        ThreadCounters& c = counters;
+        ++c.allocations;
+        c.bytes += size;
+        c.live += size;
+        c.peak = std::max(c.peak, c.live);
+
+        return block + HeaderSize;
+    }
+
+    void Release(void* p) noexcept
+    {
+        if (!p)
+            return;
+
+        auto block = static_cast<char*>(p) - HeaderSize;
+        counters.live -= *reinterpret_cast<size_t*>(block);
+
+        std::free(block);
+    }
+}
+
+void* operator new(size_t size)
+{
+    if (void* p = Allocate(size))
+        return p;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return ::operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    Release(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    Release(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    Release(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    Release(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    Release(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    Release(p);
+}
+
+#endif // #if defined(DRAFTER_ALLOC_STATS)
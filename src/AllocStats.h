@@ -0,0 +1,66 @@
+//
+//  AllocStats.h
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#ifndef DRAFTER_ALLOCSTATS_H
+#define DRAFTER_ALLOCSTATS_H
+
+#include <cstddef>
+
+namespace drafter
+{
+
+    /**
+     *  \brief allocations made by a thread
+     *
+     *  Allocations are counted only if drafter is built with
+     *  DRAFTER_ALLOC_STATS, which replaces global operator new and delete.
+     *  Otherwise all counters stay zero.
+     */
+    struct AllocStats {
+        size_t allocations = 0;
+        size_t bytes = 0;     // bytes requested by all allocations
+        size_t peakBytes = 0; // highest number of live bytes above starting level
+
+        AllocStats& operator+=(const AllocStats& other) noexcept;
+    };
+
+    /**
+     *  \brief true if drafter is built with DRAFTER_ALLOC_STATS
+     */
+    constexpr bool AllocStatsEnabled() noexcept
+    {
+#if defined(DRAFTER_ALLOC_STATS)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     *  \brief measure allocations of current thread during lifetime of the scope
+     *
+     *  Scopes can nest, peak of outer scope is kept when inner scope ends.
+     */
+    class AllocScope
+    {
+        size_t allocations_;
+        size_t bytes_;
+        std::ptrdiff_t live_;
+        std::ptrdiff_t peak_;
+
+    public:
+        AllocScope() noexcept;
+        ~AllocScope();
+
+        AllocScope(const AllocScope&) = delete;
+        AllocScope& operator=(const AllocScope&) = delete;
+
+        /// Allocations made since the scope was entered
+        AllocStats get() const noexcept;
+    };
+}
+
+#endif // #ifndef DRAFTER_ALLOCSTATS_H
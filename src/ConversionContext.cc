@@ -8,12 +8,50 @@
 
 #include "ConversionContext.h"
 
+#include <cstring>
+
 namespace drafter
 {
 
     ConversionContext::ConversionContext(const char* source, const WrapperOptions& options)
-        : newLinesIndex(GetLinesEndIndex(source)), options(options)
+        : ConversionContext(source, std::strlen(source), options)
+    {
+    }
+
+    ConversionContext::ConversionContext(const char* source, size_t length, const WrapperOptions& options)
+        : ConversionContext(mdp::ByteBufferView(source, length), options)
+    {
+    }
+
+    ConversionContext::ConversionContext(const mdp::ByteBufferView& source, const WrapperOptions& options)
+        : symbols(std::make_shared<refract::SymbolTable>()),
+          registry(ownRegistry),
+          source(source),
+          newLinesIndex(std::make_shared<LazyNewLinesIndex>()),
+          options(options)
+    {
+    }
+
+    ConversionContext::ConversionContext(ConversionContext& parent, refract::Registry& registry)
+        : symbols(parent.symbols),
+          registry(registry),
+          source(parent.source),
+          newLinesIndex(parent.newLinesIndex),
+          options(parent.options)
+    {
+    }
+
+    const NewLinesIndex& ConversionContext::GetNewLinesIndex() const
+    {
+        std::call_once(newLinesIndex->built,
+            [this]() { newLinesIndex->index = GetLinesEndIndex(source.data(), source.length()); });
+
+        return newLinesIndex->index;
+    }
+
+    std::unique_ptr<ConversionContext> ConversionContext::Fork()
     {
+        return std::unique_ptr<ConversionContext>(new ConversionContext(*this, registry));
     }
 
     void ConversionContext::warn(const snowcrash::Warning& warning)
@@ -8,9 +8,14 @@
 #ifndef DRAFTER_CONVERSIONCONTEXT_H
 #define DRAFTER_CONVERSIONCONTEXT_H
 
+#include "refract/ExpandVisitor.h"
 #include "refract/Registry.h"
 #include "snowcrash.h"
 #include "SourceMapUtils.h"
+#include "PipelineStats.h"
+
+#include <memory>
+#include <mutex>
 
 namespace drafter
 {
@@ -19,15 +24,56 @@ namespace drafter
 
     class ConversionContext
     {
-        refract::Registry registry;
-        const NewLinesIndex newLinesIndex;
+        // names of the document, shared with forked contexts; declared
+        // first to be released after everything referring to it
+        std::shared_ptr<refract::SymbolTable> symbols;
+
+        refract::Registry ownRegistry; // not used by forked contexts
+        refract::Registry& registry;
+
+        // named types expanded so far, the registry does not change once
+        // RegisterNamedTypes() is done
+        refract::ExpansionCache expansionCache;
+
+        const mdp::ByteBufferView source;
+
+        // built on first use, only annotations need line/column positions;
+        // shared with forked contexts
+        struct LazyNewLinesIndex {
+            std::once_flag built;
+            NewLinesIndex index;
+        };
+        std::shared_ptr<LazyNewLinesIndex> newLinesIndex;
 
     public:
+        /**
+         *  \param source Source data, has to outlive the context
+         *  \param options Conversion options
+         */
         ConversionContext(const char* source, const WrapperOptions& options);
 
+        /**
+         *  \param source Source data, need not be NUL-terminated and has to outlive the context
+         *  \param length Length of source data in bytes
+         *  \param options Conversion options
+         */
+        ConversionContext(const char* source, size_t length, const WrapperOptions& options);
+
+        /**
+         *  \param source Source data, has to outlive the context
+         *  \param options Conversion options
+         */
+        ConversionContext(const mdp::ByteBufferView& source, const WrapperOptions& options);
+
+        ConversionContext(const ConversionContext&) = delete;
+        ConversionContext& operator=(const ConversionContext&) = delete;
+
         const WrapperOptions& options;
         std::vector<snowcrash::Warning> warnings;
 
+        // optional, collected only if set
+        PipelineStats* stats = nullptr;
+
         inline refract::Registry& GetNamedTypesRegistry()
         {
             return registry;
@@ -38,12 +84,42 @@ namespace drafter
             return registry;
         }
 
-        inline const NewLinesIndex& GetNewLinesIndex() const
+        inline refract::ExpansionCache& GetExpansionCache()
+        {
+            return expansionCache;
+        }
+
+        /**
+         *  \brief Names of the document, interned while converting it
+         *
+         *  Elements converted by the context refer to it, whoever keeps
+         *  them past the context has to keep the table too.
+         */
+        inline const std::shared_ptr<refract::SymbolTable>& GetSymbolTable() const
         {
-            return newLinesIndex;
+            return symbols;
         }
 
+        /**
+         *  \brief Ends of lines of the source, built once on first use
+         *
+         *  Safe to call concurrently, also from forked contexts.
+         */
+        const NewLinesIndex& GetNewLinesIndex() const;
+
         void warn(const snowcrash::Warning& warning);
+
+        /**
+         *  \brief context converting a part of the document concurrently with other parts
+         *
+         *  Shares source, options and named types, which must not change while it
+         *  is used. Warnings and expanded named types are its own, stats are not
+         *  collected unless the caller sets them.
+         */
+        std::unique_ptr<ConversionContext> Fork();
+
+    private:
+        ConversionContext(ConversionContext& parent, refract::Registry& registry);
     };
 }
 #endif // #ifndef DRAFTER_CONVERSIONCONTEXT_H
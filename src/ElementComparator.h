@@ -10,8 +10,10 @@
 
 #include "refract/InfoElements.h"
 #include <algorithm>
+#include <functional>
 #include <iterator>
 #include <type_traits>
+#include <vector>
 
 namespace drafter
 {
@@ -63,20 +63,35 @@ namespace drafter
         ElementInfo() = default;
         ElementInfo(StoredT v, SourceMapT m) : value(std::move(v)), sourceMap(std::move(m)) {}
 
-        ElementInfo(const ElementInfo& other)
-        {
-            sourceMap = other.sourceMap;
-            std::transform(other.value.begin(), other.value.end(), std::back_inserter(value), [](const auto& element) {
-                return element->clone();
-            });
-        }
-
+        ElementInfo(const ElementInfo& other) = delete;
         ElementInfo(ElementInfo&&) = default;
 
         ElementInfo& operator=(const ElementInfo&) = delete;
         ElementInfo& operator=(ElementInfo&&) = default;
 
         ~ElementInfo() = default;
+
+        /// Deep copy, ElementInfo is moved everywhere else
+        ElementInfo clone() const
+        {
+            ElementInfo copy;
+            copy.sourceMap = sourceMap;
+            cloneValue(value, copy.value);
+            return copy;
+        }
+
+    private:
+        static void cloneValue(const std::string& from, std::string& to)
+        {
+            to = from;
+        }
+
+        static void cloneValue(const std::deque<std::unique_ptr<refract::IElement> >& from,
+            std::deque<std::unique_ptr<refract::IElement> >& to)
+        {
+            std::transform(
+                from.begin(), from.end(), std::back_inserter(to), [](const auto& element) { return element->clone(); });
+        }
     };
 
     struct DescriptionInfo {
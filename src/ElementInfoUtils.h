@@ -58,8 +58,9 @@ namespace drafter
     ElementInfoContainer<T> CloneElementInfoContainer(const ElementInfoContainer<T>& infoContainer)
     {
         ElementInfoContainer<T> copy;
-        std::copy(infoContainer.begin(), infoContainer.end(), std::back_inserter(copy));
-        return std::move(copy);
+        for (const auto& info : infoContainer)
+            copy.push_back(info.clone());
+        return copy;
     }
 }
 
@@ -1,9 +1,10 @@
 #include "NamedTypesRegistry.h"
 
-#include <algorithm>
-#include <map>
 #include <set>
+#include <sstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "Blueprint.h"
 #include "ConversionContext.h"
@@ -51,18 +52,30 @@ namespace drafter
             }
         }
 
+        // index of a named type not defined in the document
+        const size_t NoType = static_cast<size_t>(-1);
+
+        ///
+        /// Named types in the order they have to be registered in
+        ///
+        /// Graph of named types with an edge to the parent type and to every
+        /// named type used by a member or mixin, sorted topologically in
+        /// O(V+E). Circular references through members are valid MSON
+        /// (recursive structures) and are broken at the point they close,
+        /// circular inheritance is an error.
+        ///
         struct DependencyTypeInfo {
 
-            typedef std::map<std::string, std::string> InheritanceMap;
-            InheritanceMap childToParent;
-
             typedef std::set<std::string> Members;
-            typedef std::map<std::string, Members> MembersMap;
 
-            MembersMap objectToMembers;
+            const DataStructures& types;
+
+            std::unordered_map<std::string, size_t> byName; // last definition wins
+            std::vector<size_t> parents;                    // NoType if not a named type
+            std::vector<std::vector<size_t> > members;      // named types used by members
 
-            typedef std::map<std::string, const snowcrash::DataStructure*> ElementMap;
-            ElementMap nameToElement;
+            std::vector<mson::BaseTypeName> baseTypes;
+            std::vector<size_t> order;
 
             const std::string& parent(const snowcrash::DataStructure* ds) const
             {
@@ -186,164 +199,152 @@ namespace drafter
                 return collectMembers(ds->sections);
             }
 
-            Members collectMembers(const std::string& id, const MembersMap& members, Members& resolved)
+            size_t find(const std::string& typeName) const
             {
-                Members collected;
-
-                if (resolved.find(id) != resolved.end()) {
-                    return collected;
-                }
-
-                resolved.insert(id);
-
-                MembersMap::const_iterator member = members.find(id);
-                if (member == members.end()) {
-                    return collected;
-                }
+                auto it = byName.find(typeName);
+                return it == byName.end() ? NoType : it->second;
+            }
 
-                for (Members::const_iterator i = member->second.begin(); i != member->second.end(); ++i) {
-                    Members sub = collectMembers(*i, members, resolved);
-                    collected.insert(*i);
-                    collected.insert(sub.begin(), sub.end());
-                }
+            mson::BaseTypeName GetType(const snowcrash::DataStructure* ds) const
+            {
+                return ds->typeDefinition.typeSpecification.name.base;
+            }
 
-                return collected;
+            [[noreturn]] void CircularInheritance(size_t type) const
+            {
+                std::ostringstream out;
+                out << "base type '" << name(types[type].node) << "' circularly referencing itself";
+                throw snowcrash::Error(out.str(), snowcrash::MSONError, types[type].sourceMap->name.sourceMap);
             }
 
-            DependencyTypeInfo(const DataStructures& elements)
+            // base type of every named type, taken from the nearest ancestor defining it
+            void resolveBaseTypes()
             {
+                enum State : char
+                {
+                    Unresolved,
+                    InProgress,
+                    Resolved
+                };
 
-                // map inheritance && element
-                for (DataStructures::const_iterator i = elements.begin(); i != elements.end(); ++i) {
+                std::vector<State> state(types.size(), Unresolved);
+                std::vector<size_t> chain;
 
-                    nameToElement[name(i->node)] = &(*i->node);
+                baseTypes.assign(types.size(), mson::UndefinedTypeName);
 
-                    if (hasParent(i->node)) {
-                        childToParent[name(i->node)] = parent(i->node);
+                for (size_t i = 0; i < types.size(); ++i) {
+                    size_t t = i;
 
-#ifdef DEBUG_DEPENDENCIES
-                        std::cout << "Parent: " << name(i->node) << "=>" << parent(i->node) << std::endl;
-#endif
+                    for (; t != NoType && state[t] == Unresolved; t = parents[t]) {
+                        state[t] = InProgress;
+                        chain.push_back(t);
                     }
-                }
-
-                // Map members
-                MembersMap members;
-                for (DataStructures::const_iterator i = elements.begin(); i != elements.end(); ++i) {
-                    members[name(i->node)] = collectMembers(i->node);
-                }
-
-                // Map members into deep
-                for (MembersMap::const_iterator i = members.begin(); i != members.end(); ++i) {
-                    Members resolved;
-                    objectToMembers[i->first] = collectMembers(i->first, members, resolved);
-                }
 
-#ifdef DEBUG_DEPENDENCIES
-                // debug out members
-                for (MembersMap::const_iterator i = objectToMembers.begin(); i != objectToMembers.end(); ++i) {
-                    std::cout << "Members: " << i->first << std::endl;
-                    for (Members::const_iterator it = objectToMembers[i->first].begin();
-                         it != objectToMembers[i->first].end();
-                         ++it) {
-                        std::cout << " - " << *it << std::endl;
+                    if (t != NoType && state[t] == InProgress) {
+                        CircularInheritance(t);
                     }
-                }
-#endif /* DEBUG_DEPENDENCIES */
-            }
-
-            bool hasMember(const snowcrash::DataStructure* object, const snowcrash::DataStructure* member) const
-            {
-                MembersMap::const_iterator members = objectToMembers.find(name(object));
-                if (members == objectToMembers.end()) {
-                    return false;
-                }
-
-                return members->second.find(name(member)) != members->second.end();
-            }
 
-            bool hasAncestor(const snowcrash::DataStructure* object, const snowcrash::DataStructure* ancestor) const
-            {
-                std::string s = name(object);
-                const std::string& isAncestor = name(ancestor);
+                    mson::BaseTypeName base = t == NoType ? mson::UndefinedTypeName : baseTypes[t];
 
-                while (!s.empty()) {
-                    if (s == isAncestor) {
-                        return true;
-                    }
+                    for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+                        if (GetType(types[*it].node) != mson::UndefinedTypeName) {
+                            base = GetType(types[*it].node);
+                        }
 
-                    InheritanceMap::const_iterator i = childToParent.find(s);
-                    if (i == childToParent.end()) {
-                        return false;
+                        baseTypes[*it] = base;
+                        state[*it] = Resolved;
                     }
 
-                    s = i->second;
+                    chain.clear();
                 }
-
-                return false;
             }
 
-            mson::BaseTypeName GetType(const snowcrash::DataStructure* ds) const
+            // dependencies first, in order of definition otherwise
+            void sortTopologically()
             {
-                return ds->typeDefinition.typeSpecification.name.base;
-            }
+                enum State : char
+                {
+                    Unvisited,
+                    Visiting,
+                    Visited
+                };
+
+                struct Frame {
+                    size_t type;
+                    size_t next; // dependency to visit, 0 is parent
+                };
+
+                std::vector<State> state(types.size(), Unvisited);
+                std::vector<Frame> stack;
+
+                order.reserve(types.size());
+
+                for (size_t root = 0; root < types.size(); ++root) {
+                    if (state[root] != Unvisited) {
+                        continue;
+                    }
 
-            mson::BaseTypeName ResolveType(const snowcrash::DataStructure* object) const
-            {
-                std::string s = name(object);
+                    state[root] = Visiting;
+                    stack.push_back(Frame{ root, 0 });
 
-                while (!s.empty()) {
-                    ElementMap::const_iterator ei = nameToElement.find(s);
-                    if (ei == nameToElement.end()) {
-                        return mson::UndefinedTypeName;
-                    }
+                    while (!stack.empty()) {
+                        Frame& frame = stack.back();
+                        const size_t t = frame.type;
 
-                    mson::BaseTypeName type = GetType(ei->second);
+                        if (frame.next > members[t].size()) {
+                            state[t] = Visited;
+                            order.push_back(t);
+                            stack.pop_back();
+                            continue;
+                        }
 
-                    if (type != mson::UndefinedTypeName) {
-                        return type;
-                    }
+                        const size_t dependency = frame.next == 0 ? parents[t] : members[t][frame.next - 1];
+                        ++frame.next;
 
-                    InheritanceMap::const_iterator i = childToParent.find(s);
-                    if (i == childToParent.end() || (s == i->second)) {
-                        return mson::UndefinedTypeName;
-                    }
+                        // already registered or closing a circular reference
+                        if (dependency == NoType || state[dependency] != Unvisited) {
+                            continue;
+                        }
 
-                    s = i->second;
+                        state[dependency] = Visiting;
+                        stack.push_back(Frame{ dependency, 0 });
+                    }
                 }
-
-                return mson::UndefinedTypeName;
             }
-        };
 
-        struct InheritanceComparator {
+            DependencyTypeInfo(const DataStructures& elements)
+                : types(elements), parents(elements.size(), NoType), members(elements.size())
+            {
+                for (size_t i = 0; i < types.size(); ++i) {
+                    byName[name(types[i].node)] = i;
+                }
 
-            const DependencyTypeInfo& typeInfo;
+                for (size_t i = 0; i < types.size(); ++i) {
+                    const snowcrash::DataStructure* ds = types[i].node;
 
-            InheritanceComparator(const DependencyTypeInfo& typeInfo) : typeInfo(typeInfo) {}
+                    if (hasParent(ds)) {
+                        parents[i] = find(parent(ds));
 
-            /* This is a comparator for std::sort so it has to compare
-             * objects in strictly weak ordering otherwise it would crash
-             * with sort going out of container bounds, see
-             * http://stackoverflow.com/questions/24048022/what-causes-stdsort-to-access-address-out-of-range
-             * for more details.
-             * The order is following, if F has S as an ancestor or a member
-             * then S < F and conversely, if none of this applies we compare objects by
-             * names to provide some ordering for all objects as we don't
-             * really care.
-             */
-            bool operator()(DataStructures::const_reference first, DataStructures::const_reference second)
-            {
+#ifdef DEBUG_DEPENDENCIES
+                        std::cout << "Parent: " << name(ds) << "=>" << parent(ds) << std::endl;
+#endif
+                    }
 
-                if (typeInfo.hasAncestor(first.node, second.node) || typeInfo.hasMember(first.node, second.node)) {
-                    return false;
-                }
+                    for (const auto& member : collectMembers(ds)) {
+                        const size_t m = find(member);
+
+                        if (m != NoType && m != i) {
+                            members[i].push_back(m);
+                        }
 
-                if (typeInfo.hasAncestor(second.node, first.node) || typeInfo.hasMember(second.node, first.node)) {
-                    return true;
+#ifdef DEBUG_DEPENDENCIES
+                        std::cout << "Member: " << name(ds) << " - " << member << std::endl;
+#endif
+                    }
                 }
 
-                return typeInfo.name(first.node) < typeInfo.name(second.node);
+                resolveBaseTypes();
+                sortTopologically();
             }
         };
 
@@ -362,19 +363,18 @@ namespace drafter
 
         DependencyTypeInfo typeInfo(found);
 
-        std::sort(found.begin(), found.end(), InheritanceComparator(typeInfo));
-
 #ifdef DEBUG_DEPENDENCIES
         std::cout << "==BASE TYPE ORDER==" << std::endl;
 #endif /* DEBUG_DEPENDENCIES */
 
         // first level registration - we will create empty elements with correct type info
-        for (DataStructures::const_iterator i = found.begin(); i != found.end(); ++i) {
+        for (size_t type : typeInfo.order) {
+            const auto i = &found[type];
             const std::string& name = i->node->name.symbol.literal;
 
-            const RefractElementFactory& factory = FactoryFromType(typeInfo.ResolveType(i->node));
+            const RefractElementFactory& factory = FactoryFromType(typeInfo.baseTypes[type]);
             auto element = factory.Create(std::string(), eValue);
-            element->meta().set("id", from_primitive(name));
+            element->meta().set(sym::id, from_primitive(name));
 
             try {
                 context.GetNamedTypesRegistry().add(std::move(element));
@@ -385,7 +385,8 @@ namespace drafter
             }
         }
 
-        for (DataStructures::const_iterator i = found.begin(); i != found.end(); ++i) {
+        for (size_t type : typeInfo.order) {
+            const auto i = &found[type];
 
             if (!i->node->name.symbol.literal.empty()) {
 
@@ -393,9 +394,7 @@ namespace drafter
                 auto element = MSONToRefract(*i, context);
 
 #ifdef DEBUG_DEPENDENCIES
-                TypeQueryVisitor v;
-                v.visit(*element);
-                std::cout << name << " [" << v.get() << "]" << std::endl;
+                std::cout << name << " [" << static_cast<int>(element->kind()) << "]" << std::endl;
 #endif /* DEBUG_DEPENDENCIES */
 
                 // remove preregistrated element
@@ -411,6 +410,9 @@ namespace drafter
             }
         }
 
+        // all named types are complete, resolve their inheritance once
+        context.GetNamedTypesRegistry().freeze();
+
 #ifdef DEBUG_DEPENDENCIES
         std::cout << "==DEPENDENCIES INFO END==" << std::endl;
 #endif /* DEBUG_DEPENDENCIES */
@@ -62,13 +62,13 @@ namespace drafter
 
         static const NodeType* NullNode()
         {
-            static NodeType nullNode;
+            static const NodeType nullNode{};
             return &nullNode;
         }
 
         static const SourceMapType* NullSourceMap()
         {
-            static SourceMapType nullSourceMap;
+            static const SourceMapType nullSourceMap{};
             return &nullSourceMap;
         }
 
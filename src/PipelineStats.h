@@ -0,0 +1,113 @@
+//
+//  PipelineStats.h
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#ifndef DRAFTER_PIPELINESTATS_H
+#define DRAFTER_PIPELINESTATS_H
+
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
+
+#include "AllocStats.h"
+#include "refract/CloneStats.h"
+
+namespace drafter
+{
+
+    /**
+     *  \brief time spent in parsing stages and work counters of a single parse
+     *
+     *  Stages nest: `refract` includes `expand`, `jsonBody` and `jsonSchema`,
+     *  `total` covers everything from markdown parsing to the finished result.
+     */
+    struct PipelineStats {
+        using clock = std::chrono::steady_clock;
+
+        struct Stage {
+            clock::duration time{};
+            AllocStats alloc; // zero unless built with DRAFTER_ALLOC_STATS
+            refract::CloneStats clones;
+        };
+
+        Stage parse;         // markdown and snowcrash
+        Stage registerTypes; // RegisterNamedTypes()
+        Stage refract;       // BlueprintToRefract()
+        Stage expand;        // ExpandRefract()
+        Stage jsonBody;      // generated message bodies
+        Stage jsonSchema;    // generated message body schemas
+        Stage total;
+
+        size_t elements = 0;
+        size_t expandCalls = 0;
+        size_t jsonBodies = 0;
+        size_t jsonSchemas = 0;
+    };
+
+    /**
+     *  \brief add stats of a forked context converting on another thread
+     *
+     *  Allocations and clones of the other thread are added to `refract` and
+     *  `total`, whose time is the wall time of the calling thread. Times of
+     *  `expand`, `jsonBody` and `jsonSchema` are summed over threads, so
+     *  they can exceed `refract`.
+     */
+    inline void AddForkedStats(PipelineStats& stats, const PipelineStats& forked)
+    {
+        for (auto stage : { &PipelineStats::refract, &PipelineStats::total }) {
+            (stats.*stage).alloc += forked.refract.alloc;
+            (stats.*stage).clones += forked.refract.clones;
+        }
+
+        for (auto stage : { &PipelineStats::expand, &PipelineStats::jsonBody, &PipelineStats::jsonSchema }) {
+            (stats.*stage).time += (forked.*stage).time;
+            (stats.*stage).alloc += (forked.*stage).alloc;
+            (stats.*stage).clones += (forked.*stage).clones;
+        }
+
+        stats.expandCalls += forked.expandCalls;
+        stats.jsonBodies += forked.jsonBodies;
+        stats.jsonSchemas += forked.jsonSchemas;
+    }
+
+    /**
+     *  \brief add time and allocations spent in scope to a stage of PipelineStats
+     *
+     *  Does nothing if stats are not collected
+     */
+    class StageTimer
+    {
+        PipelineStats* stats_;
+        PipelineStats::Stage PipelineStats::*stage_;
+        PipelineStats::clock::time_point start_;
+        AllocScope alloc_;
+        refract::CloneScope clones_;
+
+    public:
+        StageTimer(PipelineStats* stats, PipelineStats::Stage PipelineStats::*stage)
+            : stats_(stats), //
+              stage_(stage),
+              start_(stats ? PipelineStats::clock::now() : PipelineStats::clock::time_point{}),
+              alloc_(),
+              clones_()
+        {
+        }
+
+        StageTimer(const StageTimer&) = delete;
+        StageTimer& operator=(const StageTimer&) = delete;
+
+        ~StageTimer()
+        {
+            if (stats_) {
+                PipelineStats::Stage& stage = stats_->*stage_;
+                stage.time += PipelineStats::clock::now() - start_;
+                stage.alloc += alloc_.get();
+                stage.clones += clones_.get();
+            }
+        }
+    };
+}
+
+#endif // #ifndef DRAFTER_PIPELINESTATS_H
@@ -20,8 +20,12 @@
 #include "utils/log/Trivial.h"
 #include "utils/so/JsonIo.h"
 
+#include <atomic>
+#include <exception>
 #include <iterator>
 #include <set>
+#include <system_error>
+#include <thread>
 
 #include "NamedTypesRegistry.h"
 #include "ConversionContext.h"
@@ -70,7 +74,7 @@ namespace
         }
 
         {
-            auto& content = element->get();
+            auto& content = element->mutate();
 
             NodeInfoToElements(collection, transformFunctor, content, context);
 
@@ -85,18 +89,30 @@ namespace
         return !action.isNull() && !action.node->method.empty();
     }
 
-    NodeInfoByValue<snowcrash::Asset> renderPayloadBody(
-        const NodeInfo<snowcrash::Payload>& payload, RenderFormat format, const IElement& expanded)
+    // JSON values and schemas are generated from an already expanded element,
+    // which never fails nor warns, so they are skipped if only annotations are kept
+    NodeInfoByValue<snowcrash::Asset> renderPayloadBody(const NodeInfo<snowcrash::Payload>& payload,
+        RenderFormat format,
+        const IElement& expanded,
+        ConversionContext& context)
     {
-        if (payload.node->body.empty() && format != UndefinedRenderFormat) {
+        if (payload.node->body.empty() && format != UndefinedRenderFormat && !context.options.validateOnly) {
             std::stringstream ss{};
             switch (format) {
                 case JSONRenderFormat: {
+                    StageTimer timer(context.stats, &PipelineStats::jsonBody);
+                    if (context.stats)
+                        ++context.stats->jsonBodies;
+
                     drafter::utils::so::serialize_json(ss, refract::generateJsonValue(expanded));
                     break;
                 }
 
                 case JSONSchemaRenderFormat: {
+                    StageTimer timer(context.stats, &PipelineStats::jsonSchema);
+                    if (context.stats)
+                        ++context.stats->jsonSchemas;
+
                     drafter::utils::so::serialize_json(ss, refract::schema::generateJsonSchema(expanded));
                     break;
                 }
@@ -109,10 +125,17 @@ namespace
         return NodeInfoByValue<snowcrash::Asset>{ payload.node->body, &payload.sourceMap->body };
     }
 
-    NodeInfoByValue<snowcrash::Asset> renderPayloadSchema(
-        const NodeInfo<snowcrash::Payload>& payload, RenderFormat format, const IElement& expanded)
+    NodeInfoByValue<snowcrash::Asset> renderPayloadSchema(const NodeInfo<snowcrash::Payload>& payload,
+        RenderFormat format,
+        const IElement& expanded,
+        ConversionContext& context)
     {
-        if (payload.node->schema.empty() && !payload.node->attributes.empty() && format == JSONRenderFormat) {
+        if (payload.node->schema.empty() && !payload.node->attributes.empty() && format == JSONRenderFormat
+            && !context.options.validateOnly) {
+            StageTimer timer(context.stats, &PipelineStats::jsonSchema);
+            if (context.stats)
+                ++context.stats->jsonSchemas;
+
             std::stringstream ss{};
             drafter::utils::so::serialize_json(ss, refract::schema::generateJsonSchema(expanded));
 
@@ -321,7 +344,7 @@ std::unique_ptr<IElement> PayloadToRefract( //
                 MAKE_NODE_INFO(payload, headers), context, HeaderToRefract, SerializeKey::HTTPHeaders));
     }
 
-    auto& content = result->get();
+    auto& content = result->mutate();
 
     if (!payload.node->description.empty())
         content.push_back(CopyToRefract(MAKE_NODE_INFO(payload, description)));
@@ -345,8 +368,8 @@ std::unique_ptr<IElement> PayloadToRefract( //
             || (payload.node->schema.empty() && renderFormat == JSONRenderFormat))
             if (auto mson = MSONToRefract(MAKE_NODE_INFO(action, attributes), context)) {
                 if (auto actionAttributeExpanded = ExpandRefract(std::move(mson), context)) {
-                    payloadBody = renderPayloadBody(payload, renderFormat, *actionAttributeExpanded);
-                    payloadSchema = renderPayloadSchema(payload, renderFormat, *actionAttributeExpanded);
+                    payloadBody = renderPayloadBody(payload, renderFormat, *actionAttributeExpanded, context);
+                    payloadSchema = renderPayloadSchema(payload, renderFormat, *actionAttributeExpanded, context);
                 }
             }
 
@@ -355,14 +378,23 @@ std::unique_ptr<IElement> PayloadToRefract( //
             && ((payload.node->body.empty() && renderFormat != UndefinedRenderFormat)
                    || (payload.node->schema.empty() && renderFormat == JSONRenderFormat))) {
 
-            if (!payloadAttributeElement)
-                payloadAttributeElement = MSONToRefract(MAKE_NODE_INFO(payload, attributes), context);
-            if (!payloadAttributeExpanded)
-                payloadAttributeExpanded = ExpandRefract(clone(*payloadAttributeElement), context);
+            // render from the expanded copy, keep the original for the dataStructure
+            const IElement* rendered = payloadAttributeExpanded.get();
+            std::unique_ptr<IElement> expanded;
 
-            if (payloadAttributeExpanded) {
-                payloadBody = renderPayloadBody(payload, renderFormat, *payloadAttributeExpanded);
-                payloadSchema = renderPayloadSchema(payload, renderFormat, *payloadAttributeExpanded);
+            if (!rendered) {
+                if (!payloadAttributeElement)
+                    payloadAttributeElement = MSONToRefract(MAKE_NODE_INFO(payload, attributes), context);
+
+                if (payloadAttributeElement) {
+                    expanded = ExpandRefract(*payloadAttributeElement, context);
+                    rendered = expanded ? expanded.get() : payloadAttributeElement.get();
+                }
+            }
+
+            if (rendered) {
+                payloadBody = renderPayloadBody(payload, renderFormat, *rendered, context);
+                payloadSchema = renderPayloadSchema(payload, renderFormat, *rendered, context);
             }
         }
     }
@@ -410,7 +442,7 @@ std::unique_ptr<ArrayElement> TransactionToRefract(const NodeInfo<snowcrash::Tra
     ConversionContext& context)
 {
     auto element = make_element<ArrayElement>();
-    auto& content = element->get();
+    auto& content = element->mutate();
 
     element->element(SerializeKey::HTTPTransaction);
 
@@ -452,7 +484,7 @@ std::unique_ptr<ArrayElement> ActionToRefract(const NodeInfo<snowcrash::Action>&
             SerializeKey::Data, DataStructureToRefract(MAKE_NODE_INFO(action, attributes), context));
     }
 
-    auto& content = element->get();
+    auto& content = element->mutate();
 
     if (!action.node->description.empty())
         content.push_back(CopyToRefract(MAKE_NODE_INFO(action, description)));
@@ -514,7 +546,7 @@ std::unique_ptr<ArrayElement> ResourceToRefract(
             SerializeKey::HrefVariables, ParametersToRefract(MAKE_NODE_INFO(resource, parameters), context));
     }
 
-    auto& content = element->get();
+    auto& content = element->mutate();
 
     if (!resource.node->description.empty())
         content.push_back(CopyToRefract(MAKE_NODE_INFO(resource, description)));
@@ -536,7 +568,8 @@ const snowcrash::SourceMap<snowcrash::Elements>* GetElementChildrenSourceMap(
                                                                       &element.sourceMap->content.elements();
 }
 
-std::unique_ptr<ArrayElement> CategoryToRefract(const NodeInfo<snowcrash::Element>& element, ConversionContext& context)
+// category without its elements
+std::unique_ptr<ArrayElement> EmptyCategoryToRefract(const NodeInfo<snowcrash::Element>& element)
 {
     auto category = make_element<ArrayElement>();
 
@@ -551,7 +584,13 @@ std::unique_ptr<ArrayElement> CategoryToRefract(const NodeInfo<snowcrash::Elemen
             SerializeKey::Classes, make_element<ArrayElement>(from_primitive(SerializeKey::DataStructures)));
     }
 
-    auto& content = category->get();
+    return category;
+}
+
+std::unique_ptr<ArrayElement> CategoryToRefract(const NodeInfo<snowcrash::Element>& element, ConversionContext& context)
+{
+    auto category = EmptyCategoryToRefract(element);
+    auto& content = category->mutate();
 
     if (!element.node->content.elements().empty()) {
         const NodeInfo<snowcrash::Elements> elementsNodeInfo
@@ -585,6 +624,158 @@ std::unique_ptr<IElement> ElementToRefract(const NodeInfo<snowcrash::Element>& e
     }
 }
 
+namespace
+{
+    // conversion of one element of the document, done by a forked context
+    struct ConversionTask {
+        NodeInfo<snowcrash::Element> element;
+
+        std::unique_ptr<IElement> result;
+        snowcrash::Warnings warnings;
+        std::exception_ptr error;
+
+        explicit ConversionTask(const NodeInfo<snowcrash::Element>& element) : element(element) {}
+    };
+
+    // top level element of the document, a category is converted by a task per element it contains
+    struct ConversionPart {
+        NodeInfo<snowcrash::Element> element;
+        bool category;
+        size_t first; // tasks of the part
+        size_t last;
+    };
+
+    bool IsCategory(const NodeInfo<snowcrash::Element>& element)
+    {
+        return element.node->element == snowcrash::Element::CategoryElement;
+    }
+
+    // free threads take tasks in document order, stats of other threads
+    // than the calling one are merged after they are joined
+    void RunConversionTasks(std::vector<ConversionTask>& tasks, size_t threads, ConversionContext& context)
+    {
+        std::atomic<size_t> next{ 0 };
+
+        size_t poolSize = threads ? threads : std::thread::hardware_concurrency();
+        poolSize = std::min<size_t>(std::max<size_t>(poolSize, 1), tasks.size());
+
+        std::vector<PipelineStats> forkedStats(context.stats ? poolSize : 0);
+
+        auto worker = [&](size_t slot) {
+            auto forked = context.Fork();
+            SymbolScope names(*forked->GetSymbolTable());
+
+            // the calling thread is already measured by the refract stage
+            if (context.stats)
+                forked->stats = slot ? &forkedStats[slot] : context.stats;
+
+            StageTimer timer(slot ? forked->stats : nullptr, &PipelineStats::refract);
+
+            for (size_t i = next++; i < tasks.size(); i = next++) {
+                auto& task = tasks[i];
+
+                try {
+                    task.result = ElementToRefract(task.element, *forked);
+                } catch (...) {
+                    task.error = std::current_exception();
+                }
+
+                task.warnings = std::move(forked->warnings);
+                forked->warnings.clear();
+            }
+        };
+
+        std::vector<std::thread> pool;
+
+        try {
+            for (size_t i = 1; i < poolSize; ++i) {
+                pool.emplace_back(worker, i);
+            }
+        } catch (const std::system_error&) {
+            // continue with threads already running
+        }
+
+        worker(0);
+
+        for (auto& thread : pool) {
+            thread.join();
+        }
+
+        for (size_t i = 1; i < forkedStats.size(); ++i) {
+            AddForkedStats(*context.stats, forkedStats[i]);
+        }
+    }
+
+    // result of a task as if it was converted serially
+    std::unique_ptr<IElement> MergeConversionTask(ConversionTask& task, ConversionContext& context)
+    {
+        for (const auto& warning : task.warnings) {
+            context.warn(warning);
+        }
+
+        if (task.error) {
+            std::rethrow_exception(task.error);
+        }
+
+        return std::move(task.result);
+    }
+
+    ///
+    /// Convert elements of the document concurrently
+    ///
+    /// Named types are not modified once registered, so resources and data
+    /// structures do not depend on each other. Results and warnings are
+    /// merged in document order, the first error in document order is
+    /// rethrown; the outcome is the same as of serial conversion.
+    ///
+    void ElementsToRefractConcurrently(const NodeInfo<snowcrash::Elements>& elements,
+        ArrayElement::ValueType& content,
+        ConversionContext& context)
+    {
+        NodeInfoCollection<snowcrash::Elements> collection(elements);
+
+        std::vector<ConversionPart> parts;
+        std::vector<ConversionTask> tasks;
+
+        for (const auto& element : collection) {
+            ConversionPart part{ element, IsCategory(element), tasks.size(), tasks.size() };
+
+            if (part.category) {
+                NodeInfoCollection<snowcrash::Elements> children(
+                    MakeNodeInfo(&element.node->content.elements(), GetElementChildrenSourceMap(element)));
+
+                for (const auto& child : children) {
+                    tasks.emplace_back(child);
+                }
+            } else {
+                tasks.emplace_back(element);
+            }
+
+            part.last = tasks.size();
+            parts.push_back(part);
+        }
+
+        RunConversionTasks(tasks, context.options.threads, context);
+
+        for (const auto& part : parts) {
+            if (!part.category) {
+                content.push_back(MergeConversionTask(tasks[part.first], context));
+                continue;
+            }
+
+            auto category = EmptyCategoryToRefract(part.element);
+            auto& children = category->mutate();
+
+            for (size_t i = part.first; i < part.last; ++i) {
+                children.push_back(MergeConversionTask(tasks[i], context));
+            }
+
+            RemoveEmptyElements(children);
+            content.push_back(std::move(category));
+        }
+    }
+}
+
 std::unique_ptr<IElement> drafter::BlueprintToRefract(
     const NodeInfo<snowcrash::Blueprint>& blueprint, ConversionContext& context)
 {
@@ -595,7 +786,7 @@ std::unique_ptr<IElement> drafter::BlueprintToRefract(
     ast->meta().set(SerializeKey::Classes, make_element<ArrayElement>(from_primitive(SerializeKey::API)));
     ast->meta().set(SerializeKey::Title, PrimitiveToRefract(MAKE_NODE_INFO(blueprint, name)));
 
-    auto& content = ast->get();
+    auto& content = ast->mutate();
 
     if (!blueprint.node->description.empty())
         content.push_back(CopyToRefract(MAKE_NODE_INFO(blueprint, description)));
@@ -605,7 +796,18 @@ std::unique_ptr<IElement> drafter::BlueprintToRefract(
             CollectionToRefract<ArrayElement>(MAKE_NODE_INFO(blueprint, metadata), context, MetadataToRefract));
     }
 
-    NodeInfoToElements(MAKE_NODE_INFO(blueprint, content.elements()), ElementToRefract, content, context);
+    if (context.options.validateOnly) {
+        // only annotations are kept, every element is dropped as soon as it is converted
+        NodeInfoCollection<snowcrash::Elements> elements(MAKE_NODE_INFO(blueprint, content.elements()));
+
+        for (const auto& element : elements) {
+            ElementToRefract(element, context);
+        }
+    } else if (context.options.threads == 1) {
+        NodeInfoToElements(MAKE_NODE_INFO(blueprint, content.elements()), ElementToRefract, content, context);
+    } else {
+        ElementsToRefractConcurrently(MAKE_NODE_INFO(blueprint, content.elements()), content, context);
+    }
 
     RemoveEmptyElements(content);
 
@@ -12,6 +12,7 @@
 #include "RefractSourceMap.h"
 #include "refract/VisitorUtils.h"
 #include "refract/ExpandVisitor.h"
+#include "refract/Exception.h"
 #include "refract/PrintVisitor.h"
 #include "refract/InfoElementsUtils.h"
 
@@ -120,26 +121,23 @@ namespace
 
     mson::BaseTypeName NamedTypeFromElement(const IElement& element)
     {
-        TypeQueryVisitor type;
-        Visit(type, element);
-
-        switch (type.get()) {
-            case TypeQueryVisitor::Boolean:
+        switch (element.kind()) {
+            case ElementKind::Boolean:
                 return mson::BooleanTypeName;
 
-            case TypeQueryVisitor::Number:
+            case ElementKind::Number:
                 return mson::NumberTypeName;
 
-            case TypeQueryVisitor::String:
+            case ElementKind::String:
                 return mson::StringTypeName;
 
-            case TypeQueryVisitor::Array:
+            case ElementKind::Array:
                 return mson::ArrayTypeName;
 
-            case TypeQueryVisitor::Enum:
+            case ElementKind::Enum:
                 return mson::EnumTypeName;
 
-            case TypeQueryVisitor::Object:
+            case ElementKind::Object:
                 return mson::ObjectTypeName;
 
             default:
@@ -172,7 +170,7 @@ namespace
         }
 
         auto attr = make_element<ArrayElement>();
-        auto& content = attr->get();
+        auto& content = attr->mutate();
 
         if (ta & mson::RequiredTypeAttribute) {
             content.push_back(from_primitive(SerializeKey::Required));
@@ -396,34 +394,36 @@ namespace
         }
     };
 
-    mson::BaseTypeName RefractElementTypeToMsonType(TypeQueryVisitor::ElementType type)
+    mson::BaseTypeName RefractElementTypeToMsonType(ElementKind type)
     {
         switch (type) {
-            case TypeQueryVisitor::String:
+            case ElementKind::String:
                 return mson::StringTypeName;
 
-            case TypeQueryVisitor::Number:
+            case ElementKind::Number:
                 return mson::NumberTypeName;
 
-            case TypeQueryVisitor::Boolean:
+            case ElementKind::Boolean:
                 return mson::BooleanTypeName;
 
-            case TypeQueryVisitor::Array:
+            case ElementKind::Array:
                 return mson::ArrayTypeName;
 
-            case TypeQueryVisitor::Object:
+            case ElementKind::Object:
                 return mson::ObjectTypeName;
 
-            case TypeQueryVisitor::Enum:
+            case ElementKind::Enum:
                 return mson::EnumTypeName;
 
-            case TypeQueryVisitor::Null:
-            case TypeQueryVisitor::Holder:
-            case TypeQueryVisitor::Member:
-            case TypeQueryVisitor::Ref:
-            case TypeQueryVisitor::Extend:
-            case TypeQueryVisitor::Option:
-            case TypeQueryVisitor::Select:;
+            case ElementKind::Null:
+            case ElementKind::Holder:
+            case ElementKind::Member:
+            case ElementKind::Ref:
+            case ElementKind::Extend:
+            case ElementKind::Option:
+            case ElementKind::Select:
+            case ElementKind::SourceMap:
+            case ElementKind::Unknown:;
         };
         return mson::UndefinedTypeName;
     }
@@ -435,9 +435,7 @@ namespace
             return mson::UndefinedTypeName;
         }
 
-        TypeQueryVisitor query;
-        VisitBy(*e, query);
-        return RefractElementTypeToMsonType(query.get());
+        return RefractElementTypeToMsonType(e->kind());
     }
 
     /**
@@ -701,7 +699,7 @@ namespace
         std::unique_ptr<E> operator()(ElementInfo<E>&& info) const
         {
             auto result = make_element<E>();
-            std::move(info.value.begin(), info.value.end(), std::back_inserter(result->get()));
+            std::move(info.value.begin(), info.value.end(), std::back_inserter(result->mutate()));
             return std::move(result);
         }
     };
@@ -720,7 +718,7 @@ namespace
             } else if (v.size() > 1) {
                 auto result = make_empty<EnumElement>();
                 auto enumerations = make_element<ArrayElement>();
-                std::move(v.begin(), v.end(), std::back_inserter(enumerations->get()));
+                std::move(v.begin(), v.end(), std::back_inserter(enumerations->mutate()));
                 result->attributes().set(SerializeKey::Enumerations, std::move(enumerations));
                 return result;
             }
@@ -762,13 +760,13 @@ namespace
             if (!hint.value.empty()) {
                 if (element.empty())
                     element.set();
-                std::move(hint.value.begin(), hint.value.end(), std::back_inserter(element.get()));
+                std::move(hint.value.begin(), hint.value.end(), std::back_inserter(element.mutate()));
             }
 
             if (!info.value.empty()) {
                 if (element.empty())
                     element.set();
-                std::move(info.value.begin(), info.value.end(), std::back_inserter(element.get()));
+                std::move(info.value.begin(), info.value.end(), std::back_inserter(element.mutate()));
             }
         }
     };
@@ -832,7 +830,7 @@ namespace
                         AppendInfoElement<ArrayElement>(info->attributes(), "typeAttributes", dsd::String{ "fixed" });
                     }
                 });
-                auto enumsElement = make_element<ArrayElement>(enums);
+                auto enumsElement = make_element<ArrayElement>(std::move(enums));
                 element.attributes().set(SerializeKey::Enumerations, std::move(enumsElement));
             }
         }
@@ -850,7 +848,7 @@ namespace
         ElementInfoToElement<T> fetch;
         std::transform(std::make_move_iterator(values.begin()),
             std::make_move_iterator(values.end()),
-            std::back_inserter(a->get()),
+            std::back_inserter(a->mutate()),
             fetch);
 
         element.attributes().set(key, std::move(a));
@@ -871,7 +869,7 @@ namespace
 
         std::transform(std::make_move_iterator(info.value.begin()),
             std::make_move_iterator(info.value.end()),
-            std::back_inserter(a->get()),
+            std::back_inserter(a->mutate()),
             [](auto node) { return make_element<EnumElement>(dsd::Enum{ std::move(node) }); });
 
         element.attributes().set(key, std::move(a));
@@ -1007,7 +1005,7 @@ namespace
             return true;
         }
 
-        if (TypeQueryVisitor::as<StringElement>(FindRootAncestor(
+        if (dyn_cast<StringElement>(FindRootAncestor(
                 variable.typeDefinition.typeSpecification.name.symbol.literal, context.GetNamedTypesRegistry()))) {
             return true;
         }
@@ -1092,7 +1090,7 @@ namespace
                 NodeInfo<mson::ValueMember>(property.node, property.sourceMap), context, defaultNestedType, dummy));
 
         if (!property.node->name.variable.empty()) {
-            element->attributes().set("variable", from_primitive(true));
+            element->attributes().set(SerializeKey::Variable, from_primitive(true));
         }
 
         mson::TypeAttributes attrs = property.node->valueDefinition.typeDefinition.attributes;
@@ -1278,13 +1276,13 @@ namespace
             // "option" element handles directly all elements in group
             if (oneOfInfo.node->klass == mson::Element::GroupClass) {
                 MsonElementsToRefract(MakeNodeInfo(oneOfInfo.node->content.elements(), oneOfInfo.sourceMap->elements()),
-                    std::back_inserter(option->get()),
+                    std::back_inserter(option->mutate()),
                     context);
             } else {
-                option->get().push_back(MsonElementToRefract(oneOfInfo, context, mson::StringTypeName));
+                option->mutate().push_back(MsonElementToRefract(oneOfInfo, context, mson::StringTypeName));
             }
 
-            select->get().push_back(std::move(option));
+            select->mutate().push_back(std::move(option));
         }
 
         return std::move(select);
@@ -1407,12 +1405,30 @@ std::unique_ptr<IElement> drafter::ExpandRefract(std::unique_ptr<IElement> eleme
         return nullptr;
     }
 
-    ExpandVisitor expander(context.GetNamedTypesRegistry());
-    Visit(expander, *element);
-
-    if (auto expanded = expander.get()) { // investigate expanded TODO XXX
+    if (auto expanded = ExpandRefract(*element, context)) { // investigate expanded TODO XXX
         return expanded;
     }
 
     return element;
 }
+
+std::unique_ptr<IElement> drafter::ExpandRefract(const IElement& element, ConversionContext& context)
+{
+    StageTimer timer(context.stats, &PipelineStats::expand);
+
+    if (context.stats)
+        ++context.stats->expandCalls;
+
+    ExpandVisitor expander(
+        context.GetNamedTypesRegistry(), &context.GetExpansionCache(), context.options.expansionLimit);
+
+    try {
+        Visit(expander, element);
+    } catch (const ExpansionLimitExceeded& e) {
+        // keep the element unexpanded rather than running out of memory
+        context.warn(snowcrash::Warning(std::string(e.what()) + ", it is not expanded", snowcrash::MSONError));
+        return nullptr;
+    }
+
+    return expander.get();
+}
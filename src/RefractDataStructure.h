@@ -22,6 +22,9 @@ namespace drafter
         const NodeInfo<snowcrash::DataStructure>& dataStructure, ConversionContext& context);
     std::unique_ptr<refract::IElement> ExpandRefract(
         std::unique_ptr<refract::IElement> element, ConversionContext& context);
+
+    /// Expanded copy of element, nullptr if there is nothing to expand
+    std::unique_ptr<refract::IElement> ExpandRefract(const refract::IElement& element, ConversionContext& context);
 }
 
 #endif // #ifndef DRAFTER_REFRACTDATASTRUCTURE_H
@@ -3,29 +3,17 @@
 
 using namespace refract;
 
-namespace
-{
-    std::unique_ptr<IElement> CharacterRangeToRefract(const mdp::CharactersRange& sourceMap)
-    {
-        return make_element<ArrayElement>( //
-            from_primitive(sourceMap.location),
-            from_primitive(sourceMap.length));
-    }
-
-} // namespace
-
 std::unique_ptr<IElement> drafter::SourceMapToRefract(const mdp::CharactersRangeSet& sourceMap)
 {
-    auto sourceMapElement = make_element<ArrayElement>();
-    sourceMapElement->element(SerializeKey::SourceMap);
+    dsd::SourceMap::Ranges ranges;
+    ranges.reserve(2 * sourceMap.size());
 
-    std::transform( //
-        sourceMap.begin(),
-        sourceMap.end(),
-        std::back_inserter(sourceMapElement->get()),
-        CharacterRangeToRefract);
+    for (const auto& range : sourceMap) {
+        ranges.push_back(range.location);
+        ranges.push_back(range.length);
+    }
 
-    return make_element<ArrayElement>(std::move(sourceMapElement));
+    return make_element<ArrayElement>(make_element<SourceMapElement>(std::move(ranges)));
 }
 
 std::unique_ptr<IElement> drafter::SourceMapToRefractWithColumnLineInfo(
@@ -37,17 +25,17 @@ std::unique_ptr<IElement> drafter::SourceMapToRefractWithColumnLineInfo(
     std::transform( //
         sourceMap.begin(),
         sourceMap.end(),
-        std::back_inserter(sourceMapElement->get()),
+        std::back_inserter(sourceMapElement->mutate()),
         [&context](auto& sourceMap) {
             auto position = GetLineFromMap(context.GetNewLinesIndex(), sourceMap);
 
             auto location = make_element<NumberElement>(sourceMap.location);
-            location->attributes().set("line", from_primitive(position.fromLine));
-            location->attributes().set("column", from_primitive(position.fromColumn));
+            location->attributes().set(refract::sym::line, from_primitive(position.fromLine));
+            location->attributes().set(refract::sym::column, from_primitive(position.fromColumn));
 
             auto length = make_element<NumberElement>(sourceMap.length);
-            length->attributes().set("line", from_primitive(position.toLine));
-            length->attributes().set("column", from_primitive(position.toColumn));
+            length->attributes().set(refract::sym::line, from_primitive(position.toLine));
+            length->attributes().set(refract::sym::column, from_primitive(position.toColumn));
 
             return make_element<ArrayElement>(std::move(location), std::move(length));
         });
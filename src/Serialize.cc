@@ -15,97 +15,97 @@
 using namespace drafter;
 using namespace refract;
 
-const std::string SerializeKey::Metadata = "metadata";
-const std::string SerializeKey::Reference = "reference";
-const std::string SerializeKey::Id = "id";
-const std::string SerializeKey::Name = "name";
-const std::string SerializeKey::Description = "description";
-const std::string SerializeKey::DataStructure = "dataStructure";
-const std::string SerializeKey::DataStructures = "dataStructures";
-const std::string SerializeKey::ResourceGroup = "resourceGroup";
-const std::string SerializeKey::ResourceGroups = "resourceGroups";
-const std::string SerializeKey::Resource = "resource";
-const std::string SerializeKey::Resources = "resources";
-const std::string SerializeKey::URI = "uri";
-const std::string SerializeKey::URITemplate = "uriTemplate";
-const std::string SerializeKey::Assets = "assets";
-const std::string SerializeKey::Actions = "actions";
-const std::string SerializeKey::Action = "action";
-const std::string SerializeKey::Relation = "relation";
-const std::string SerializeKey::Attributes = "attributes";
-const std::string SerializeKey::Method = "method";
-const std::string SerializeKey::Examples = "examples";
-const std::string SerializeKey::Requests = "requests";
-const std::string SerializeKey::Responses = "responses";
-const std::string SerializeKey::Body = "body";
-const std::string SerializeKey::Schema = "schema";
-const std::string SerializeKey::Headers = "headers";
-const std::string SerializeKey::Model = "model";
-const std::string SerializeKey::Value = "value";
-const std::string SerializeKey::Parameters = "parameters";
-const std::string SerializeKey::Type = "type";
-const std::string SerializeKey::Required = "required";
-const std::string SerializeKey::Default = "default";
-const std::string SerializeKey::Enumerations = "enumerations";
-const std::string SerializeKey::Nullable = "nullable";
-const std::string SerializeKey::Example = "example";
-const std::string SerializeKey::Values = "values";
-
-const std::string SerializeKey::Source = "source";
-const std::string SerializeKey::Resolved = "resolved";
-
-const std::string SerializeKey::Element = "element";
-const std::string SerializeKey::Role = "role";
-
-const std::string SerializeKey::Version = "_version";
-const std::string SerializeKey::Ast = "ast";
-const std::string SerializeKey::Sourcemap = "sourcemap";
-const std::string SerializeKey::Error = "error";
-const std::string SerializeKey::Warning = "warning";
-const std::string SerializeKey::Warnings = "warnings";
-const std::string SerializeKey::AnnotationCode = "code";
-const std::string SerializeKey::AnnotationMessage = "message";
-const std::string SerializeKey::AnnotationLocation = "location";
-const std::string SerializeKey::AnnotationLocationIndex = "index";
-const std::string SerializeKey::AnnotationLocationLength = "length";
-
-const std::string SerializeKey::Variable = "variable";
-const std::string SerializeKey::Content = "content";
-const std::string SerializeKey::Meta = "meta";
-const std::string SerializeKey::Title = "title";
-const std::string SerializeKey::Classes = "classes";
-const std::string SerializeKey::Samples = "samples";
-const std::string SerializeKey::TypeAttributes = "typeAttributes";
-const std::string SerializeKey::Optional = "optional";
-const std::string SerializeKey::Fixed = "fixed";
-const std::string SerializeKey::FixedType = "fixedType";
-const std::string SerializeKey::True = "true";
-const std::string SerializeKey::Generic = "generic";
-const std::string SerializeKey::Enum = "enum";
-const std::string SerializeKey::Ref = "ref";
-const std::string SerializeKey::Href = "href";
-const std::string SerializeKey::Path = "path";
-
-const std::string SerializeKey::Category = "category";
-const std::string SerializeKey::Copy = "copy";
-const std::string SerializeKey::API = "api";
-const std::string SerializeKey::User = "user";
-const std::string SerializeKey::Transition = "transition";
-const std::string SerializeKey::HrefVariables = "hrefVariables";
-const std::string SerializeKey::HTTPHeaders = "httpHeaders";
-const std::string SerializeKey::HTTPTransaction = "httpTransaction";
-const std::string SerializeKey::ContentType = "contentType";
-const std::string SerializeKey::HTTPResponse = "httpResponse";
-const std::string SerializeKey::HTTPRequest = "httpRequest";
-const std::string SerializeKey::StatusCode = "statusCode";
-const std::string SerializeKey::Asset = "asset";
-const std::string SerializeKey::MessageBody = "messageBody";
-const std::string SerializeKey::MessageBodySchema = "messageBodySchema";
-const std::string SerializeKey::Data = "data";
-
-const std::string SerializeKey::ParseResult = "parseResult";
-const std::string SerializeKey::Annotation = "annotation";
-const std::string SerializeKey::SourceMap = "sourceMap";
+constexpr const refract::Symbol& SerializeKey::Metadata;
+constexpr const refract::Symbol& SerializeKey::Reference;
+constexpr const refract::Symbol& SerializeKey::Id;
+constexpr const refract::Symbol& SerializeKey::Name;
+constexpr const refract::Symbol& SerializeKey::Description;
+constexpr const refract::Symbol& SerializeKey::DataStructure;
+constexpr const refract::Symbol& SerializeKey::DataStructures;
+constexpr const refract::Symbol& SerializeKey::ResourceGroup;
+constexpr const refract::Symbol& SerializeKey::ResourceGroups;
+constexpr const refract::Symbol& SerializeKey::Resource;
+constexpr const refract::Symbol& SerializeKey::Resources;
+constexpr const refract::Symbol& SerializeKey::URI;
+constexpr const refract::Symbol& SerializeKey::URITemplate;
+constexpr const refract::Symbol& SerializeKey::Assets;
+constexpr const refract::Symbol& SerializeKey::Actions;
+constexpr const refract::Symbol& SerializeKey::Action;
+constexpr const refract::Symbol& SerializeKey::Relation;
+constexpr const refract::Symbol& SerializeKey::Attributes;
+constexpr const refract::Symbol& SerializeKey::Method;
+constexpr const refract::Symbol& SerializeKey::Examples;
+constexpr const refract::Symbol& SerializeKey::Requests;
+constexpr const refract::Symbol& SerializeKey::Responses;
+constexpr const refract::Symbol& SerializeKey::Body;
+constexpr const refract::Symbol& SerializeKey::Schema;
+constexpr const refract::Symbol& SerializeKey::Headers;
+constexpr const refract::Symbol& SerializeKey::Model;
+constexpr const refract::Symbol& SerializeKey::Value;
+constexpr const refract::Symbol& SerializeKey::Parameters;
+constexpr const refract::Symbol& SerializeKey::Type;
+constexpr const refract::Symbol& SerializeKey::Required;
+constexpr const refract::Symbol& SerializeKey::Default;
+constexpr const refract::Symbol& SerializeKey::Enumerations;
+constexpr const refract::Symbol& SerializeKey::Nullable;
+constexpr const refract::Symbol& SerializeKey::Example;
+constexpr const refract::Symbol& SerializeKey::Values;
+
+constexpr const refract::Symbol& SerializeKey::Source;
+constexpr const refract::Symbol& SerializeKey::Resolved;
+
+constexpr const refract::Symbol& SerializeKey::Element;
+constexpr const refract::Symbol& SerializeKey::Role;
+
+constexpr const refract::Symbol& SerializeKey::Version;
+constexpr const refract::Symbol& SerializeKey::Ast;
+constexpr const refract::Symbol& SerializeKey::Sourcemap;
+constexpr const refract::Symbol& SerializeKey::Error;
+constexpr const refract::Symbol& SerializeKey::Warning;
+constexpr const refract::Symbol& SerializeKey::Warnings;
+constexpr const refract::Symbol& SerializeKey::AnnotationCode;
+constexpr const refract::Symbol& SerializeKey::AnnotationMessage;
+constexpr const refract::Symbol& SerializeKey::AnnotationLocation;
+constexpr const refract::Symbol& SerializeKey::AnnotationLocationIndex;
+constexpr const refract::Symbol& SerializeKey::AnnotationLocationLength;
+
+constexpr const refract::Symbol& SerializeKey::Variable;
+constexpr const refract::Symbol& SerializeKey::Content;
+constexpr const refract::Symbol& SerializeKey::Meta;
+constexpr const refract::Symbol& SerializeKey::Title;
+constexpr const refract::Symbol& SerializeKey::Classes;
+constexpr const refract::Symbol& SerializeKey::Samples;
+constexpr const refract::Symbol& SerializeKey::TypeAttributes;
+constexpr const refract::Symbol& SerializeKey::Optional;
+constexpr const refract::Symbol& SerializeKey::Fixed;
+constexpr const refract::Symbol& SerializeKey::FixedType;
+constexpr const refract::Symbol& SerializeKey::True;
+constexpr const refract::Symbol& SerializeKey::Generic;
+constexpr const refract::Symbol& SerializeKey::Enum;
+constexpr const refract::Symbol& SerializeKey::Ref;
+constexpr const refract::Symbol& SerializeKey::Href;
+constexpr const refract::Symbol& SerializeKey::Path;
+
+constexpr const refract::Symbol& SerializeKey::Category;
+constexpr const refract::Symbol& SerializeKey::Copy;
+constexpr const refract::Symbol& SerializeKey::API;
+constexpr const refract::Symbol& SerializeKey::User;
+constexpr const refract::Symbol& SerializeKey::Transition;
+constexpr const refract::Symbol& SerializeKey::HrefVariables;
+constexpr const refract::Symbol& SerializeKey::HTTPHeaders;
+constexpr const refract::Symbol& SerializeKey::HTTPTransaction;
+constexpr const refract::Symbol& SerializeKey::ContentType;
+constexpr const refract::Symbol& SerializeKey::HTTPResponse;
+constexpr const refract::Symbol& SerializeKey::HTTPRequest;
+constexpr const refract::Symbol& SerializeKey::StatusCode;
+constexpr const refract::Symbol& SerializeKey::Asset;
+constexpr const refract::Symbol& SerializeKey::MessageBody;
+constexpr const refract::Symbol& SerializeKey::MessageBodySchema;
+constexpr const refract::Symbol& SerializeKey::Data;
+
+constexpr const refract::Symbol& SerializeKey::ParseResult;
+constexpr const refract::Symbol& SerializeKey::Annotation;
+constexpr const refract::Symbol& SerializeKey::SourceMap;
 
 using namespace drafter;
 
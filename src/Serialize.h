@@ -15,6 +15,7 @@
 #include "NodeInfo.h"
 
 #include "refract/Element.h"
+#include "refract/Symbol.h"
 #include "refract/Registry.h"
 
 /** Version of API Blueprint serialization */
@@ -41,138 +42,167 @@ namespace drafter
 
     // Options struct for drafter
     struct WrapperOptions {
+        // Elements one expansion of a data structure may produce
+        static constexpr size_t DefaultExpansionLimit = 1000000;
+
         const bool generateSourceMap;
         const bool expandMSON;
+        const bool validateOnly;     // only annotations are kept, assets are not serialized
+        const size_t expansionLimit; // larger expansions are reported and skipped, 0 if unlimited
+        const size_t threads;        // converting resource groups and resources, 0 for number of cores
+
+        WrapperOptions(const bool generateSourceMap,
+            const bool expandMSON,
+            const bool validateOnly,
+            const size_t expansionLimit = DefaultExpansionLimit,
+            const size_t threads = 1)
+            : generateSourceMap(generateSourceMap),
+              expandMSON(expandMSON),
+              validateOnly(validateOnly),
+              expansionLimit(expansionLimit),
+              threads(threads)
+        {
+        }
 
         WrapperOptions(const bool generateSourceMap, const bool expandMSON)
-            : generateSourceMap(generateSourceMap), expandMSON(expandMSON)
+            : generateSourceMap(generateSourceMap),
+              expandMSON(expandMSON),
+              validateOnly(false),
+              expansionLimit(DefaultExpansionLimit),
+              threads(1)
         {
         }
 
-        WrapperOptions(const bool generateSourceMap) : generateSourceMap(generateSourceMap), expandMSON(false) {}
+        WrapperOptions(const bool generateSourceMap)
+            : generateSourceMap(generateSourceMap),
+              expandMSON(false),
+              validateOnly(false),
+              expansionLimit(DefaultExpansionLimit),
+              threads(1)
+        {
+        }
 
-        WrapperOptions() : generateSourceMap(false), expandMSON(false) {}
+        WrapperOptions()
+            : generateSourceMap(false),
+              expandMSON(false),
+              validateOnly(false),
+              expansionLimit(DefaultExpansionLimit),
+              threads(1)
+        {
+        }
     };
 
     /**
      *  AST and Refract entities serialization keys
      */
     struct SerializeKey {
-        static const std::string Metadata;
-        static const std::string Reference;
-        static const std::string Id;
-        static const std::string Name;
-        static const std::string Description;
-        static const std::string DataStructure;
-        static const std::string DataStructures;
-        static const std::string ResourceGroup;
-        static const std::string ResourceGroups;
-        static const std::string Resource;
-        static const std::string Resources;
-        static const std::string URI;
-        static const std::string URITemplate;
-        static const std::string Assets;
-        static const std::string Actions;
-        static const std::string Action;
-        static const std::string Relation;
-        static const std::string Attributes;
-        static const std::string Examples;
-        static const std::string Transaction;
-        static const std::string Method;
-        static const std::string Requests;
-        static const std::string Responses;
-        static const std::string Body;
-        static const std::string Schema;
-        static const std::string Headers;
-        static const std::string Model;
-        static const std::string Value;
-        static const std::string Parameters;
-        static const std::string Type;
-        static const std::string Required;
-        static const std::string Default;
-        static const std::string Enumerations;
-        static const std::string Nullable;
-        static const std::string Example;
-        static const std::string Values;
-
-        static const std::string Source;
-        static const std::string Resolved;
-
-        static const std::string Literal;
-        static const std::string Variable;
-        static const std::string TypeDefinition;
-        static const std::string TypeSpecification;
-        static const std::string NestedTypes;
-        static const std::string Sections;
-        static const std::string Class;
-        static const std::string Content;
-        static const std::string ValueDefinition;
-
-        static const std::string Element;
-        static const std::string Role;
-
-        static const std::string Version;
-        static const std::string Ast;
-        static const std::string Sourcemap;
-        static const std::string Error;
-        static const std::string Warning;
-        static const std::string Warnings;
-        static const std::string AnnotationCode;
-        static const std::string AnnotationMessage;
-        static const std::string AnnotationLocation;
-        static const std::string AnnotationLocationIndex;
-        static const std::string AnnotationLocationLength;
+        static constexpr const refract::Symbol& Metadata = refract::sym::metadata;
+        static constexpr const refract::Symbol& Reference = refract::sym::reference;
+        static constexpr const refract::Symbol& Id = refract::sym::id;
+        static constexpr const refract::Symbol& Name = refract::sym::name;
+        static constexpr const refract::Symbol& Description = refract::sym::description;
+        static constexpr const refract::Symbol& DataStructure = refract::sym::dataStructure;
+        static constexpr const refract::Symbol& DataStructures = refract::sym::dataStructures;
+        static constexpr const refract::Symbol& ResourceGroup = refract::sym::resourceGroup;
+        static constexpr const refract::Symbol& ResourceGroups = refract::sym::resourceGroups;
+        static constexpr const refract::Symbol& Resource = refract::sym::resource;
+        static constexpr const refract::Symbol& Resources = refract::sym::resources;
+        static constexpr const refract::Symbol& URI = refract::sym::uri;
+        static constexpr const refract::Symbol& URITemplate = refract::sym::uriTemplate;
+        static constexpr const refract::Symbol& Assets = refract::sym::assets;
+        static constexpr const refract::Symbol& Actions = refract::sym::actions;
+        static constexpr const refract::Symbol& Action = refract::sym::action;
+        static constexpr const refract::Symbol& Relation = refract::sym::relation;
+        static constexpr const refract::Symbol& Attributes = refract::sym::attributes;
+        static constexpr const refract::Symbol& Examples = refract::sym::examples;
+        static constexpr const refract::Symbol& Method = refract::sym::method;
+        static constexpr const refract::Symbol& Requests = refract::sym::requests;
+        static constexpr const refract::Symbol& Responses = refract::sym::responses;
+        static constexpr const refract::Symbol& Body = refract::sym::body;
+        static constexpr const refract::Symbol& Schema = refract::sym::schema;
+        static constexpr const refract::Symbol& Headers = refract::sym::headers;
+        static constexpr const refract::Symbol& Model = refract::sym::model;
+        static constexpr const refract::Symbol& Value = refract::sym::value;
+        static constexpr const refract::Symbol& Parameters = refract::sym::parameters;
+        static constexpr const refract::Symbol& Type = refract::sym::type;
+        static constexpr const refract::Symbol& Required = refract::sym::required;
+        static constexpr const refract::Symbol& Default = refract::sym::default_;
+        static constexpr const refract::Symbol& Enumerations = refract::sym::enumerations;
+        static constexpr const refract::Symbol& Nullable = refract::sym::nullable;
+        static constexpr const refract::Symbol& Example = refract::sym::example;
+        static constexpr const refract::Symbol& Values = refract::sym::values;
+
+        static constexpr const refract::Symbol& Source = refract::sym::source;
+        static constexpr const refract::Symbol& Resolved = refract::sym::resolved;
+
+        static constexpr const refract::Symbol& Variable = refract::sym::variable;
+        static constexpr const refract::Symbol& Content = refract::sym::content;
+
+        static constexpr const refract::Symbol& Element = refract::sym::element;
+        static constexpr const refract::Symbol& Role = refract::sym::role;
+
+        static constexpr const refract::Symbol& Version = refract::sym::version_;
+        static constexpr const refract::Symbol& Ast = refract::sym::ast;
+        static constexpr const refract::Symbol& Sourcemap = refract::sym::sourcemap;
+        static constexpr const refract::Symbol& Error = refract::sym::error;
+        static constexpr const refract::Symbol& Warning = refract::sym::warning;
+        static constexpr const refract::Symbol& Warnings = refract::sym::warnings;
+        static constexpr const refract::Symbol& AnnotationCode = refract::sym::code;
+        static constexpr const refract::Symbol& AnnotationMessage = refract::sym::message;
+        static constexpr const refract::Symbol& AnnotationLocation = refract::sym::location;
+        static constexpr const refract::Symbol& AnnotationLocationIndex = refract::sym::index;
+        static constexpr const refract::Symbol& AnnotationLocationLength = refract::sym::length;
 
         // Refract meta
-        static const std::string Meta;
-        static const std::string Title;
-        static const std::string Classes;
+        static constexpr const refract::Symbol& Meta = refract::sym::meta;
+        static constexpr const refract::Symbol& Title = refract::sym::title;
+        static constexpr const refract::Symbol& Classes = refract::sym::classes;
 
         // Refract MSON attributes
-        static const std::string Samples;
-        static const std::string TypeAttributes;
+        static constexpr const refract::Symbol& Samples = refract::sym::samples;
+        static constexpr const refract::Symbol& TypeAttributes = refract::sym::typeAttributes;
 
         // Refract MSON attribute "typeAttibute" values
-        static const std::string Optional;
-        static const std::string Fixed;
-        static const std::string FixedType;
+        static constexpr const refract::Symbol& Optional = refract::sym::optional;
+        static constexpr const refract::Symbol& Fixed = refract::sym::fixed;
+        static constexpr const refract::Symbol& FixedType = refract::sym::fixedType;
 
         // Literal to Bool
-        static const std::string True;
+        static constexpr const refract::Symbol& True = refract::sym::true_;
 
         // Refract MSON generic element
-        static const std::string Generic;
+        static constexpr const refract::Symbol& Generic = refract::sym::generic;
 
         // Refract (nontyped) element names
-        static const std::string Enum;
-        static const std::string Ref;
+        static constexpr const refract::Symbol& Enum = refract::sym::enum_;
+        static constexpr const refract::Symbol& Ref = refract::sym::ref;
 
         // Refract Ref Element - keys/values
-        static const std::string Href;
-        static const std::string Path;
+        static constexpr const refract::Symbol& Href = refract::sym::href;
+        static constexpr const refract::Symbol& Path = refract::sym::path;
 
         // API Namespace
-        static const std::string Category;
-        static const std::string Copy;
-        static const std::string API;
-        static const std::string User;
-        static const std::string Transition;
-        static const std::string HrefVariables;
-        static const std::string HTTPHeaders;
-        static const std::string HTTPTransaction;
-        static const std::string ContentType;
-        static const std::string HTTPResponse;
-        static const std::string HTTPRequest;
-        static const std::string StatusCode;
-        static const std::string Asset;
-        static const std::string MessageBody;
-        static const std::string MessageBodySchema;
-        static const std::string Data;
+        static constexpr const refract::Symbol& Category = refract::sym::category;
+        static constexpr const refract::Symbol& Copy = refract::sym::copy;
+        static constexpr const refract::Symbol& API = refract::sym::api;
+        static constexpr const refract::Symbol& User = refract::sym::user;
+        static constexpr const refract::Symbol& Transition = refract::sym::transition;
+        static constexpr const refract::Symbol& HrefVariables = refract::sym::hrefVariables;
+        static constexpr const refract::Symbol& HTTPHeaders = refract::sym::httpHeaders;
+        static constexpr const refract::Symbol& HTTPTransaction = refract::sym::httpTransaction;
+        static constexpr const refract::Symbol& ContentType = refract::sym::contentType;
+        static constexpr const refract::Symbol& HTTPResponse = refract::sym::httpResponse;
+        static constexpr const refract::Symbol& HTTPRequest = refract::sym::httpRequest;
+        static constexpr const refract::Symbol& StatusCode = refract::sym::statusCode;
+        static constexpr const refract::Symbol& Asset = refract::sym::asset;
+        static constexpr const refract::Symbol& MessageBody = refract::sym::messageBody;
+        static constexpr const refract::Symbol& MessageBodySchema = refract::sym::messageBodySchema;
+        static constexpr const refract::Symbol& Data = refract::sym::data;
 
         // Parse Result Namespace
-        static const std::string ParseResult;
-        static const std::string Annotation;
-        static const std::string SourceMap;
+        static constexpr const refract::Symbol& ParseResult = refract::sym::parseResult;
+        static constexpr const refract::Symbol& Annotation = refract::sym::annotation;
+        static constexpr const refract::Symbol& SourceMap = refract::sym::sourceMap;
     };
 
     template <typename T>
@@ -40,6 +40,9 @@ namespace helper
 std::unique_ptr<IElement> drafter::WrapRefract(
     snowcrash::ParseResult<snowcrash::Blueprint>& blueprint, ConversionContext& context)
 {
+    // names of the result are interned in the table of the context
+    SymbolScope names(*context.GetSymbolTable());
+
     snowcrash::Error error;
     std::unique_ptr<IElement> blueprintRefract = nullptr;
 
@@ -49,8 +52,13 @@ std::unique_ptr<IElement> drafter::WrapRefract(
 
     if (blueprint.report.error.code == snowcrash::Error::OK) {
         try {
-            RegisterNamedTypes(
-                MakeNodeInfo(blueprint.node.content.elements(), blueprint.sourceMap.content.elements()), context);
+            {
+                StageTimer timer(context.stats, &PipelineStats::registerTypes);
+                RegisterNamedTypes(
+                    MakeNodeInfo(blueprint.node.content.elements(), blueprint.sourceMap.content.elements()), context);
+            }
+
+            StageTimer timer(context.stats, &PipelineStats::refract);
             blueprintRefract = BlueprintToRefract(MakeNodeInfo(blueprint.node, blueprint.sourceMap), context);
         } catch (std::exception& e) {
             error = snowcrash::Error(e.what(), snowcrash::MSONError);
@@ -64,13 +72,14 @@ std::unique_ptr<IElement> drafter::WrapRefract(
             blueprint.report.error = error;
         }
 
-        if (blueprintRefract) {
-            parseResult->get().push_back(std::move(blueprintRefract));
+        if (blueprintRefract && !context.options.validateOnly) {
+            parseResult->mutate().push_back(std::move(blueprintRefract));
         }
     }
 
     if (blueprint.report.error.code != snowcrash::Error::OK) {
-        parseResult->get().push_back(helper::AnnotationToRefract(SerializeKey::Error, context)(blueprint.report.error));
+        parseResult->mutate().push_back(
+            helper::AnnotationToRefract(SerializeKey::Error, context)(blueprint.report.error));
     }
 
     snowcrash::Warnings& warnings = blueprint.report.warnings;
@@ -82,7 +91,7 @@ std::unique_ptr<IElement> drafter::WrapRefract(
     if (!warnings.empty()) {
         std::transform(warnings.begin(),
             warnings.end(),
-            std::back_inserter(parseResult->get()),
+            std::back_inserter(parseResult->mutate()),
             helper::AnnotationToRefract(SerializeKey::Warning, context));
     }
 
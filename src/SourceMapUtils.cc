@@ -50,14 +50,21 @@ namespace drafter
     }
 
     const NewLinesIndex GetLinesEndIndex(const std::string& source)
+    {
+        return GetLinesEndIndex(source.data(), source.length());
+    }
+
+    const NewLinesIndex GetLinesEndIndex(const char* source, size_t length)
     {
 
         NewLinesIndex out;
 
         out.push_back(0);
 
-        utils::utf8::input_iterator<std::string::const_iterator> it(source);
-        utils::utf8::input_iterator<std::string::const_iterator> e{ source.end(), source.end() };
+        const char* end = source + length;
+
+        utils::utf8::input_iterator<const char*> it{ source, end };
+        utils::utf8::input_iterator<const char*> e{ end, end };
 
         int i = 1;
         for (; it != e; ++it, ++i) {
@@ -39,6 +39,14 @@ namespace drafter
      */
     const NewLinesIndex GetLinesEndIndex(const std::string& source);
 
+    /**
+     *  \brief Given the source returns the length of all the lines in source as a vector
+     *  \param source Source data, need not be NUL-terminated
+     *  \param length Length of source data in bytes
+     *  \param out Vector containing indexes of all end line character in source
+     */
+    const NewLinesIndex GetLinesEndIndex(const char* source, size_t length);
+
 } // namespace drafter
 
 #endif
@@ -0,0 +1,263 @@
+//
+//  batch.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "batch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+#include "drafter.h"
+#include "input.h"
+
+#include "refract/Element.h"
+#include "refract/FilterVisitor.h"
+#include "refract/Query.h"
+#include "refract/Iterate.h"
+#include "refract/SerializeSo.h"
+
+#include "utils/so/JsonIo.h"
+
+using namespace drafter::utils;
+
+namespace
+{
+    const std::string BlueprintExtension = ".apib";
+
+    bool HasBlueprintExtension(const std::string& name)
+    {
+        return name.size() > BlueprintExtension.size()
+            && name.compare(name.size() - BlueprintExtension.size(), BlueprintExtension.size(), BlueprintExtension)
+            == 0;
+    }
+
+#if defined(_WIN32)
+    bool IsDirectory(const std::string& path)
+    {
+        DWORD attributes = ::GetFileAttributesA(path.c_str());
+        return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+    }
+
+    void ListDirectory(const std::string& path, std::vector<std::string>& entries)
+    {
+        WIN32_FIND_DATAA data;
+        HANDLE handle = ::FindFirstFileA((path + "\\*").c_str(), &data);
+
+        if (handle == INVALID_HANDLE_VALUE)
+            return;
+
+        do {
+            entries.push_back(data.cFileName);
+        } while (::FindNextFileA(handle, &data));
+
+        ::FindClose(handle);
+    }
+#else
+    bool IsDirectory(const std::string& path)
+    {
+        struct stat info;
+        return ::stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+    }
+
+    void ListDirectory(const std::string& path, std::vector<std::string>& entries)
+    {
+        DIR* dir = ::opendir(path.c_str());
+
+        if (!dir)
+            return;
+
+        while (struct dirent* entry = ::readdir(dir)) {
+            entries.push_back(entry->d_name);
+        }
+
+        ::closedir(dir);
+    }
+#endif
+
+    /// Recursively collect blueprints in directory, sorted to keep output stable
+    void CollectBlueprints(const std::string& path, std::vector<std::string>& files)
+    {
+        std::vector<std::string> entries;
+        ListDirectory(path, entries);
+        std::sort(entries.begin(), entries.end());
+
+        for (const auto& entry : entries) {
+            if (entry == "." || entry == "..")
+                continue;
+
+            const std::string child = path + "/" + entry;
+
+            if (IsDirectory(child)) {
+                CollectBlueprints(child, files);
+            } else if (HasBlueprintExtension(entry)) {
+                files.push_back(child);
+            }
+        }
+    }
+
+    size_t CountAnnotations(const drafter_result* result)
+    {
+        if (!result)
+            return 0;
+
+        refract::FilterVisitor filter(refract::query::Element(refract::sym::annotation));
+        refract::Iterate<refract::Children> iterate(filter);
+        iterate(*result);
+
+        return filter.elements().size();
+    }
+
+    using SessionPtr = std::unique_ptr<drafter_session, decltype(&drafter_session_free)>;
+    using ResultPtr = std::unique_ptr<drafter_result, decltype(&drafter_free_result)>;
+
+    struct BatchItem {
+        std::string file;
+        std::string record;
+        int code = 0;
+        size_t annotations = 0;
+        bool done = false;
+    };
+
+    /// Parse single blueprint and render its NDJSON record
+    void ProcessItem(const Config& config, drafter_session* session, BatchItem& item)
+    {
+        so::Object record;
+        record.data.emplace_back("file", so::String{ item.file });
+
+        InputBuffer source;
+
+        if (!source.open(item.file)) {
+            item.code = -1;
+            record.data.emplace_back("code", so::Number{ item.code });
+            record.data.emplace_back("error", so::String{ "unable to open file" });
+        } else {
+            drafter_parse_options parseOptions = { false };
+            drafter_result* result = nullptr;
+
+            if (config.validate) {
+                item.code = drafter_check_blueprint_n(source.data(), source.size(), &result, parseOptions);
+            } else {
+                item.code = drafter_session_parse_n(session, source.data(), source.size(), &result, parseOptions);
+            }
+
+            ResultPtr guard(result, &drafter_free_result);
+
+            item.annotations = CountAnnotations(result);
+
+            record.data.emplace_back("code", so::Number{ item.code });
+            record.data.emplace_back("annotations", so::Number{ item.annotations });
+
+            if (result) {
+                record.data.emplace_back("result", refract::serialize::renderSo(*result, config.sourceMap));
+            } else {
+                record.data.emplace_back("result", so::Null{});
+            }
+        }
+
+        std::ostringstream out;
+        so::serialize_json(out, record, so::packed{});
+        item.record = out.str();
+    }
+
+    int AggregateCode(int aggregate, int code)
+    {
+        if (aggregate < 0 || code < 0)
+            return -1;
+
+        return std::max(aggregate, code);
+    }
+}
+
+int ProcessBatch(const Config& config, std::ostream& out)
+{
+    std::vector<BatchItem> items;
+
+    for (const auto& input : config.inputs) {
+        std::vector<std::string> files;
+
+        if (IsDirectory(input)) {
+            CollectBlueprints(input, files);
+        } else {
+            files.push_back(input);
+        }
+
+        for (auto& file : files) {
+            items.emplace_back();
+            items.back().file = std::move(file);
+        }
+    }
+
+    size_t jobs = config.jobs ? config.jobs : std::thread::hardware_concurrency();
+    jobs = std::max<size_t>(1, std::min(jobs, items.size()));
+
+    std::atomic<size_t> next{ 0 };
+
+    // records are written in input order as soon as all preceding are done
+    std::mutex outputMutex;
+    size_t written = 0;
+
+    auto worker = [&]() {
+        SessionPtr session(drafter_session_new(), &drafter_session_free);
+
+        for (size_t i = next++; i < items.size(); i = next++) {
+            ProcessItem(config, session.get(), items[i]);
+
+            std::lock_guard<std::mutex> lock(outputMutex);
+            items[i].done = true;
+
+            for (; written < items.size() && items[written].done; ++written) {
+                out << items[written].record << "\n";
+                items[written].record.clear();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+
+    for (size_t i = 1; i < jobs; ++i) {
+        pool.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    out << std::flush;
+
+    int code = 0;
+    size_t failed = 0;
+    size_t annotated = 0;
+
+    for (const auto& item : items) {
+        code = AggregateCode(code, item.code);
+
+        if (item.code != 0) {
+            ++failed;
+        } else if (item.annotations) {
+            ++annotated;
+        }
+    }
+
+    std::cerr << items.size() << " blueprints, " << (items.size() - failed - annotated) << " OK, " << annotated
+              << " with warnings, " << failed << " failed" << std::endl;
+
+    return code;
+}
@@ -0,0 +1,35 @@
+//
+//  batch.h
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_BATCH_H
+#define DRAFTER_BATCH_H
+
+#include <iosfwd>
+
+#include "config.h"
+
+/**
+ *  \brief Parse all blueprints given as input on a pool of worker threads
+ *
+ *  Every input is either a file or a directory. Directories are searched
+ *  recursively for `*.apib` files. For every blueprint one JSON record
+ *  (NDJSON) is written to \param out, in the order of inputs. Summary is
+ *  printed to stderr.
+ *
+ *  Every blueprint is converted by a single thread, `threads` is not used,
+ *  so at most `jobs` threads are busy at once.
+ *
+ *  \param config CLI configuration, `inputs` and `jobs` drive the batch
+ *  \param out stream to write records to
+ *
+ *  \return 0 if all blueprints were parsed without error,
+ *          -1 if any input could not be read,
+ *          the highest parser error code otherwise
+ */
+int ProcessBatch(const Config& config, std::ostream& out);
+
+#endif // #ifndef DRAFTER_BATCH_H
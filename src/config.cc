@@ -25,6 +25,10 @@ namespace config
     static const std::string Version = "version";
     static const std::string UseLineNumbers = "use-line-num";
     static const std::string EnableLog = "enable-log";
+    static const std::string Batch = "batch";
+    static const std::string Jobs = "jobs";
+    static const std::string Threads = "threads";
+    static const std::string Stats = "stats";
 };
 
 void PrepareCommanLineParser(cmdline::parser& parser)
@@ -45,19 +49,36 @@ void PrepareCommanLineParser(cmdline::parser& parser)
     parser.add(
         config::UseLineNumbers, 'u', "use line and row number instead of character index when printing annotation");
     parser.add(config::EnableLog, 'L', "enable logging");
+    parser.add(config::Stats, '\0', "print time spent in parsing stages and work counters to stderr");
+    parser.add(config::Batch, 'b', "parse all input files and directories, print one JSON record per blueprint");
+    parser.add<unsigned int>(
+        config::Jobs, 'j', "number of worker threads in batch mode, 0 for number of cores", false, 0);
+    parser.add<unsigned int>(config::Threads,
+        't',
+        "number of threads converting resource groups and resources of a blueprint, 0 for number of cores, "
+        "not used in batch mode",
+        false,
+        1);
 
     std::stringstream ss;
 
     ss << "<input file>\n\n";
     ss << "API Blueprint Parser\n";
     ss << "If called without <input file>, 'drafter' will listen on stdin.\n";
+    ss << "In batch mode any number of files and directories can be given,\n";
+    ss << "directories are searched recursively for *.apib files.\n";
 
     parser.footer(ss.str());
 }
 
 void ValidateParsedCommandLine(const cmdline::parser& parser, const Config& config)
 {
-    if (parser.rest().size() > 1) {
+    if (config.batch) {
+        if (parser.rest().empty()) {
+            std::cerr << "at least one input file or directory expected in batch mode" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    } else if (parser.rest().size() > 1) {
         std::cerr << "one input file expected, got " << parser.rest().size() << std::endl;
         exit(EXIT_FAILURE);
     }
@@ -81,7 +102,11 @@ void ParseCommadLineOptions(int argc, const char* argv[], /* out */ Config& conf
 
     parser.parse_check(argc, argv);
 
-    if (!parser.rest().empty()) {
+    conf.batch = parser.exist(config::Batch);
+
+    if (conf.batch) {
+        conf.inputs = parser.rest();
+    } else if (!parser.rest().empty()) {
         conf.input = parser.rest().front();
     }
 
@@ -91,6 +116,9 @@ void ParseCommadLineOptions(int argc, const char* argv[], /* out */ Config& conf
     conf.output = parser.get<std::string>(config::Output);
     conf.sourceMap = parser.exist(config::Sourcemap);
     conf.enableLog = parser.exist(config::EnableLog);
+    conf.stats = parser.exist(config::Stats);
+    conf.jobs = parser.get<unsigned int>(config::Jobs);
+    conf.threads = parser.get<unsigned int>(config::Threads);
 
     ValidateParsedCommandLine(parser, conf);
 }
@@ -10,6 +10,7 @@
 #define DRAFTER_CONFIG_H
 
 #include <string>
+#include <vector>
 
 #include "Serialize.h"
 
@@ -21,6 +22,11 @@ struct Config {
     bool sourceMap;
     std::string output;
     bool enableLog;
+    bool stats;
+    bool batch;
+    std::vector<std::string> inputs; // batch mode inputs, files or directories
+    unsigned int jobs;               // batch mode worker threads, 0 for number of cores
+    unsigned int threads;            // threads converting a single blueprint, 0 for number of cores
 };
 
 /**
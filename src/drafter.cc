@@ -9,25 +9,33 @@
 
 #include "snowcrash.h"
 
-#include "utils/so/JsonIo.h"
-#include "utils/so/YamlIo.h"
 
 #include "refract/Element.h"
-#include "refract/FilterVisitor.h"
-#include "refract/Query.h"
-#include "refract/Iterate.h"
+#include "refract/ElementUtils.h"
 #include "refract/SerializeSo.h"
 
 #include "SerializeResult.h"      // FIXME: remove - actualy required by WrapParseResultRefract()
 #include "Serialize.h"            // FIXME: remove - actualy required by WrapperOptions
 #include "ConversionContext.h"    // FIXME: remove - required by ConversionContext
 #include "RefractDataStructure.h" // FIXME: remove - required by SerializeRefract()
+#include "PipelineStats.h"
 
 #include "Version.h"
 
 #include "reporting.h"
 
+#include <stddef.h>
 #include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <new>
+#include <streambuf>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
     char** out,
@@ -61,6 +69,82 @@ DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
 
 namespace sc = snowcrash;
 
+struct drafter_session {
+    mdp::MarkdownParser markdownParser;
+};
+
+namespace
+{
+    // names of results handed out are interned in the symbol table of the
+    // conversion that made them, it is released by drafter_free_result()
+    class ResultSymbolTables
+    {
+        std::mutex mutex_;
+        std::unordered_map<const drafter_result*, std::shared_ptr<refract::SymbolTable> > tables_;
+
+    public:
+        void keep(const drafter_result* result, std::shared_ptr<refract::SymbolTable> table)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tables_.emplace(result, std::move(table));
+        }
+
+        std::shared_ptr<refract::SymbolTable> take(const drafter_result* result)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            auto it = tables_.find(result);
+            if (it == tables_.end())
+                return nullptr;
+
+            auto table = std::move(it->second);
+            tables_.erase(it);
+            return table;
+        }
+    };
+
+    ResultSymbolTables& resultSymbolTables()
+    {
+        // never destroyed, results can be freed by destructors of other statics
+        static ResultSymbolTables* instance = new ResultSymbolTables;
+        return *instance;
+    }
+
+    drafter_error ParseBlueprint(const mdp::ByteBufferView& source,
+        drafter_result** out,
+        const drafter_parse_options& parse_opts,
+        mdp::MarkdownParser& markdownParser,
+        const drafter::WrapperOptions& wrapperOptions = drafter::WrapperOptions(),
+        drafter::PipelineStats* stats = nullptr)
+    {
+        drafter::StageTimer total(stats, &drafter::PipelineStats::total);
+
+        sc::BlueprintParserOptions scOptions = sc::ExportSourcemapOption;
+
+        if (parse_opts.requireBlueprintName) {
+            scOptions |= sc::RequireBlueprintNameOption;
+        }
+
+        sc::ParseResult<sc::Blueprint> blueprint;
+        {
+            drafter::StageTimer timer(stats, &drafter::PipelineStats::parse);
+            sc::parse(source, scOptions, blueprint, markdownParser);
+        }
+
+        drafter::ConversionContext context(source, wrapperOptions);
+        context.stats = stats;
+
+        auto result = WrapRefract(blueprint, context);
+
+        if (result)
+            resultSymbolTables().keep(result.get(), context.GetSymbolTable());
+
+        *out = result.release();
+
+        return (drafter_error)blueprint.report.error.code;
+    }
+}
+
 /* Parse API Bleuprint and return result, which is a opaque handle for
  * later use*/
 DRAFTER_API drafter_error drafter_parse_blueprint(
@@ -75,22 +159,327 @@ DRAFTER_API drafter_error drafter_parse_blueprint(
         return DRAFTER_EINVALID_OUTPUT;
     }
 
-    sc::BlueprintParserOptions scOptions = sc::ExportSourcemapOption;
+    mdp::MarkdownParser markdownParser;
+    return ParseBlueprint(source, out, parse_opts, markdownParser);
+}
+
+/* Parse API Blueprint from a buffer of given length*/
+DRAFTER_API drafter_error drafter_parse_blueprint_n(
+    const char* source, size_t length, drafter_result** out, const drafter_parse_options parse_opts)
+{
+
+    if (!source && length) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    if (!out) {
+        return DRAFTER_EINVALID_OUTPUT;
+    }
+
+    mdp::MarkdownParser markdownParser;
+    return ParseBlueprint(mdp::ByteBufferView(source, length), out, parse_opts, markdownParser);
+}
+
+namespace
+{
+    uint64_t Nanoseconds(const drafter::PipelineStats::Stage& stage)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(stage.time).count();
+    }
+
+    drafter_alloc_stats Allocations(const drafter::PipelineStats::Stage& stage)
+    {
+        drafter_alloc_stats alloc;
+
+        alloc.allocations = stage.alloc.allocations;
+        alloc.bytes = stage.alloc.bytes;
+        alloc.peak_bytes = stage.alloc.peakBytes;
+
+        return alloc;
+    }
+}
+
+/* Parse API Blueprint from a buffer of given length and collect parsing statistics*/
+DRAFTER_API drafter_error drafter_parse_blueprint_with_stats(const char* source,
+    size_t length,
+    drafter_result** out,
+    const drafter_parse_options parse_opts,
+    drafter_parse_stats* stats)
+{
+    return drafter_parse_blueprint_with_options(source, length, out, parse_opts, nullptr, stats);
+}
+
+namespace
+{
+    // options the caller knows of, the rest keeps defaults
+    drafter::WrapperOptions ConversionOptions(const drafter_conversion_options* conversion_opts)
+    {
+        const drafter::WrapperOptions defaults;
+
+        if (!conversion_opts
+            || conversion_opts->size
+                < offsetof(drafter_conversion_options, threads) + sizeof(conversion_opts->threads)) {
+            return defaults;
+        }
+
+        return drafter::WrapperOptions(defaults.generateSourceMap,
+            defaults.expandMSON,
+            defaults.validateOnly,
+            defaults.expansionLimit,
+            conversion_opts->threads);
+    }
+}
+
+/* Parse API Blueprint from a buffer of given length with conversion options*/
+DRAFTER_API drafter_error drafter_parse_blueprint_with_options(const char* source,
+    size_t length,
+    drafter_result** out,
+    const drafter_parse_options parse_opts,
+    const drafter_conversion_options* conversion_opts,
+    drafter_parse_stats* stats)
+{
+    if (!source && length) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    if (!out) {
+        return DRAFTER_EINVALID_OUTPUT;
+    }
+
+    const drafter::WrapperOptions wrapperOptions = ConversionOptions(conversion_opts);
+    mdp::MarkdownParser markdownParser;
+
+    if (!stats) {
+        return ParseBlueprint(mdp::ByteBufferView(source, length), out, parse_opts, markdownParser, wrapperOptions);
+    }
+
+    drafter::PipelineStats pipelineStats;
+
+    drafter_error result = ParseBlueprint(mdp::ByteBufferView(source, length),
+        out,
+        parse_opts,
+        markdownParser,
+        wrapperOptions,
+        &pipelineStats);
+
+    stats->parse_ns = Nanoseconds(pipelineStats.parse);
+    stats->register_ns = Nanoseconds(pipelineStats.registerTypes);
+    stats->refract_ns = Nanoseconds(pipelineStats.refract);
+    stats->expand_ns = Nanoseconds(pipelineStats.expand);
+    stats->json_body_ns = Nanoseconds(pipelineStats.jsonBody);
+    stats->json_schema_ns = Nanoseconds(pipelineStats.jsonSchema);
+    stats->total_ns = Nanoseconds(pipelineStats.total);
+
+    stats->elements = *out ? refract::countElements(**out) : 0;
+    stats->expand_calls = pipelineStats.expandCalls;
+    stats->json_bodies = pipelineStats.jsonBodies;
+    stats->json_schemas = pipelineStats.jsonSchemas;
+    stats->element_clones = pipelineStats.total.clones.elements;
+    stats->data_copies = pipelineStats.total.clones.data;
+
+    stats->parse_alloc = Allocations(pipelineStats.parse);
+    stats->register_alloc = Allocations(pipelineStats.registerTypes);
+    stats->refract_alloc = Allocations(pipelineStats.refract);
+    stats->expand_alloc = Allocations(pipelineStats.expand);
+    stats->json_body_alloc = Allocations(pipelineStats.jsonBody);
+    stats->json_schema_alloc = Allocations(pipelineStats.jsonSchema);
+    stats->total_alloc = Allocations(pipelineStats.total);
+
+    return result;
+}
+
+namespace
+{
+    drafter_error AggregateError(drafter_error aggregate, drafter_error error)
+    {
+        if (aggregate < 0 || error < 0)
+            return std::min(aggregate, error);
+
+        return std::max(aggregate, error);
+    }
+}
+
+/* Parse independent API Blueprints on a pool of threads, every thread
+ * reuses its own markdown parser*/
+DRAFTER_API drafter_error drafter_parse_many(const char* const* sources,
+    size_t count,
+    unsigned int threads,
+    drafter_result** results,
+    drafter_error* errors,
+    const drafter_parse_options parse_opts)
+{
+    if (!sources && count) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    if (!results && count) {
+        return DRAFTER_EINVALID_OUTPUT;
+    }
+
+    std::vector<drafter_error> codes(count, DRAFTER_OK);
+    std::atomic<size_t> next{ 0 };
+
+    auto worker = [&]() {
+        mdp::MarkdownParser markdownParser;
+
+        for (size_t i = next++; i < count; i = next++) {
+            results[i] = nullptr;
+
+            if (!sources[i]) {
+                codes[i] = DRAFTER_EINVALID_INPUT;
+                continue;
+            }
+
+            try {
+                codes[i] = ParseBlueprint(sources[i], &results[i], parse_opts, markdownParser);
+            } catch (...) {
+                codes[i] = DRAFTER_EUNKNOWN;
+            }
+        }
+    };
+
+    size_t poolSize = threads ? threads : std::thread::hardware_concurrency();
+    poolSize = std::min<size_t>(std::max<size_t>(poolSize, 1), count);
+
+    std::vector<std::thread> pool;
+
+    try {
+        for (size_t i = 1; i < poolSize; ++i) {
+            pool.emplace_back(worker);
+        }
+    } catch (const std::system_error&) {
+        // continue with threads already running
+    }
+
+    worker();
+
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    drafter_error result = DRAFTER_OK;
+
+    for (size_t i = 0; i < count; ++i) {
+        result = AggregateError(result, codes[i]);
+
+        if (errors) {
+            errors[i] = codes[i];
+        }
+    }
+
+    return result;
+}
+
+DRAFTER_API drafter_session* drafter_session_new(void)
+{
+    return new (std::nothrow) drafter_session;
+}
+
+DRAFTER_API drafter_error drafter_session_parse(
+    drafter_session* session, const char* source, drafter_result** out, const drafter_parse_options parse_opts)
+{
+    if (!session || !source) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    if (!out) {
+        return DRAFTER_EINVALID_OUTPUT;
+    }
+
+    return ParseBlueprint(source, out, parse_opts, session->markdownParser);
+}
 
-    if (parse_opts.requireBlueprintName) {
-        scOptions |= sc::RequireBlueprintNameOption;
+DRAFTER_API drafter_error drafter_session_parse_n(drafter_session* session,
+    const char* source,
+    size_t length,
+    drafter_result** out,
+    const drafter_parse_options parse_opts)
+{
+    if (!session || (!source && length)) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    if (!out) {
+        return DRAFTER_EINVALID_OUTPUT;
     }
 
-    sc::ParseResult<sc::Blueprint> blueprint;
-    sc::parse(source, scOptions, blueprint);
+    return ParseBlueprint(mdp::ByteBufferView(source, length), out, parse_opts, session->markdownParser);
+}
+
+DRAFTER_API void drafter_session_free(drafter_session* session)
+{
+    delete session;
+}
+
+namespace
+{
+    bool Serialize(drafter_result& res, const drafter_serialize_options& serialize_opts, std::ostream& out)
+    {
+        switch (serialize_opts.format) {
+            case DRAFTER_SERIALIZE_JSON:
+                refract::serialize::renderJson(out, res, serialize_opts.sourcemap);
+                return true;
+
+            case DRAFTER_SERIALIZE_YAML:
+                refract::serialize::renderYaml(out, res, serialize_opts.sourcemap);
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    /// Output buffer passing its content to drafter_write_cb in fixed-size chunks
+    class WriterStreamBuf : public std::streambuf
+    {
+        static constexpr std::size_t ChunkSize = 4096;
+
+        char buffer_[ChunkSize];
+        drafter_write_cb write_;
+        void* userData_;
+        bool failed_ = false;
 
-    drafter::WrapperOptions wrapperOptions;
-    drafter::ConversionContext context(source, wrapperOptions);
-    auto result = WrapRefract(blueprint, context);
+        bool flush()
+        {
+            const std::size_t size = pptr() - pbase();
 
-    *out = result.release();
+            if (size > 0 && !failed_ && write_(pbase(), size, userData_) != size)
+                failed_ = true;
 
-    return (drafter_error)blueprint.report.error.code;
+            setp(buffer_, buffer_ + ChunkSize);
+            return !failed_;
+        }
+
+    public:
+        WriterStreamBuf(drafter_write_cb write, void* userData) : write_(write), userData_(userData)
+        {
+            setp(buffer_, buffer_ + ChunkSize);
+        }
+
+        bool failed() const noexcept
+        {
+            return failed_;
+        }
+
+    protected:
+        int_type overflow(int_type ch) override
+        {
+            if (!flush())
+                return traits_type::eof();
+
+            if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+                *pptr() = traits_type::to_char_type(ch);
+                pbump(1);
+            }
+
+            return traits_type::not_eof(ch);
+        }
+
+        int sync() override
+        {
+            return flush() ? 0 : -1;
+        }
+    };
 }
 
 /* Serialize result to given format*/
@@ -102,25 +491,39 @@ DRAFTER_API char* drafter_serialize(drafter_result* res, const drafter_serialize
 
     std::ostringstream out;
 
-    switch (serialize_opts.format) {
-        case DRAFTER_SERIALIZE_JSON: {
-            auto soValue = refract::serialize::renderSo(*res, serialize_opts.sourcemap);
-            drafter::utils::so::serialize_json(out, soValue);
-            break;
-        }
-        case DRAFTER_SERIALIZE_YAML: {
-            auto soValue = refract::serialize::renderSo(*res, serialize_opts.sourcemap);
-            drafter::utils::so::serialize_yaml(out, soValue);
-            break;
-        }
-
-        default:
-            return nullptr;
+    if (!Serialize(*res, serialize_opts, out)) {
+        return nullptr;
     }
 
     return strdup(out.str().c_str());
 }
 
+/* Serialize result to given format, stream it out via writer callback*/
+DRAFTER_API drafter_error drafter_serialize_to(drafter_result* res,
+    const drafter_serialize_options serialize_opts,
+    drafter_write_cb write,
+    void* user_data)
+{
+    if (!res) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    if (!write) {
+        return DRAFTER_EINVALID_OUTPUT;
+    }
+
+    WriterStreamBuf buffer(write, user_data);
+    std::ostream out(&buffer);
+
+    if (!Serialize(*res, serialize_opts, out)) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
+    out.flush();
+
+    return buffer.failed() ? DRAFTER_EINVALID_OUTPUT : DRAFTER_OK;
+}
+
 /* Parse API Blueprint and return only annotations, if NULL than
  * document is error and warning free.*/
 DRAFTER_API drafter_error drafter_check_blueprint(
@@ -131,41 +534,45 @@ DRAFTER_API drafter_error drafter_check_blueprint(
         return DRAFTER_EINVALID_INPUT;
     }
 
+    return drafter_check_blueprint_n(source, strlen(source), res, parse_opts);
+}
+
+DRAFTER_API drafter_error drafter_check_blueprint_n(
+    const char* source, size_t length, drafter_result** res, const drafter_parse_options parse_opts)
+{
+    if (!source && length) {
+        return DRAFTER_EINVALID_INPUT;
+    }
+
     drafter_result* result = nullptr;
 
-    drafter_error ret = drafter_parse_blueprint(source, &result, parse_opts);
+    // validation mode, parse result holds annotations only
+    const drafter::WrapperOptions wrapperOptions(false, false, true);
+    mdp::MarkdownParser markdownParser;
+
+    drafter_error ret
+        = ParseBlueprint(mdp::ByteBufferView(source, length), &result, parse_opts, markdownParser, wrapperOptions);
 
     if (!result) {
         return ret;
     }
 
-    drafter_result* out = nullptr;
+    const auto annotations = refract::dyn_cast<const refract::ArrayElement>(result);
 
-    refract::FilterVisitor filter(refract::query::Element("annotation"));
-    refract::Iterate<refract::Children> iterate(filter);
-    iterate(*result);
-
-    if (!filter.empty()) {
-        refract::ArrayElement::ValueType elements;
-
-        std::transform(filter.elements().begin(),
-            filter.elements().end(),
-            std::back_inserter(elements),
-            std::bind(&refract::IElement::clone, std::placeholders::_1, refract::IElement::cAll));
-
-        out = new refract::ArrayElement(elements);
-        out->element(drafter::SerializeKey::ParseResult);
+    if (!annotations || annotations->empty() || annotations->get().empty()) {
+        drafter_free_result(result);
+        result = nullptr;
     }
 
-    drafter_free_result(result);
-
-    *res = out;
+    *res = result;
 
     return ret;
 }
 
 DRAFTER_API void drafter_free_result(drafter_result* result)
 {
+    // released after the elements referring to it
+    const auto symbols = resultSymbolTables().take(result);
     delete result;
 }
 
@@ -9,6 +9,9 @@
 #ifndef DRAFTER_H
 #define DRAFTER_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -49,6 +52,8 @@ extern "C" {
 #endif
 #endif
 
+typedef struct drafter_session drafter_session;
+
 #ifndef __cplusplus
 #include <stdbool.h>
 typedef struct drafter_result drafter_result;
@@ -74,6 +79,18 @@ typedef struct {
     bool requireBlueprintName;
 } drafter_parse_options;
 
+/* Conversion options, see drafter_parse_blueprint_with_options()
+ * - size : sizeof(drafter_conversion_options) as seen by the caller, options
+ *   which do not fit in it keep their defaults, so callers built against an
+ *   older header keep working
+ * - threads : number of threads converting resource groups and resources
+ *   of a blueprint, 1 converts them serially, 0 uses the number of cores
+ */
+typedef struct {
+    size_t size;
+    unsigned int threads;
+} drafter_conversion_options;
+
 /* Serialization options
  * - sourcemap : Include sourcemap in the serialized result
  * - format : Serialization format see above
@@ -83,6 +100,68 @@ typedef struct {
     drafter_format format;
 } drafter_serialize_options;
 
+/* Allocations made in a parsing stage, counted only if drafter is built
+ * with DRAFTER_ALLOC_STATS, otherwise all zero
+ * - allocations : number of allocations
+ * - bytes : bytes requested by all allocations
+ * - peak_bytes : highest number of live bytes allocated in stage
+ */
+typedef struct {
+    size_t allocations;
+    size_t bytes;
+    size_t peak_bytes;
+} drafter_alloc_stats;
+
+/* Parsing statistics, see drafter_parse_blueprint_with_stats()
+ * Times are in nanoseconds, stages nest. If resources are converted by
+ * several threads, refract_ns and total_ns are wall times of the calling
+ * thread, while expand_ns, json_body_ns and json_schema_ns are summed
+ * over all threads and can exceed refract_ns:
+ * - parse_ns : markdown and API Blueprint parsing
+ * - register_ns : registration of named types
+ * - refract_ns : conversion to API Elements, includes expand_ns,
+ *   json_body_ns and json_schema_ns
+ * - expand_ns : expansion of MSON data structures
+ * - json_body_ns : generation of JSON message bodies
+ * - json_schema_ns : generation of JSON Schemas
+ * - total_ns : whole parse
+ * Counters:
+ * - elements : number of elements in result, including meta and attributes
+ * - expand_calls : number of expanded MSON data structures
+ * - json_bodies : number of generated JSON message bodies
+ * - json_schemas : number of generated JSON Schemas
+ * - element_clones : number of elements deep copied during the whole parse
+ * - data_copies : number of element contents copied because they were
+ *   shared with a copy and modified
+ * Allocations of each stage, see drafter_alloc_stats:
+ * - parse_alloc, register_alloc, refract_alloc, expand_alloc,
+ *   json_body_alloc, json_schema_alloc, total_alloc
+ */
+typedef struct {
+    uint64_t parse_ns;
+    uint64_t register_ns;
+    uint64_t refract_ns;
+    uint64_t expand_ns;
+    uint64_t json_body_ns;
+    uint64_t json_schema_ns;
+    uint64_t total_ns;
+
+    size_t elements;
+    size_t expand_calls;
+    size_t json_bodies;
+    size_t json_schemas;
+    size_t element_clones;
+    size_t data_copies;
+
+    drafter_alloc_stats parse_alloc;
+    drafter_alloc_stats register_alloc;
+    drafter_alloc_stats refract_alloc;
+    drafter_alloc_stats expand_alloc;
+    drafter_alloc_stats json_body_alloc;
+    drafter_alloc_stats json_schema_alloc;
+    drafter_alloc_stats total_alloc;
+} drafter_parse_stats;
+
 typedef enum
 {
     DRAFTER_OK = 0,
@@ -113,13 +192,82 @@ DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
 DRAFTER_API drafter_error drafter_parse_blueprint(
     const char* source, drafter_result** out, const drafter_parse_options parse_opts);
 
+/* Parse API Blueprint from a buffer of given length and return result.
+ * Source does not have to be NUL-terminated, e.g. it can point into
+ * a memory mapped file. Buffer is only read during the call and never
+ * copied as a whole.
+ *
+ * Returns:
+ * - 0 if everything went smooth.
+ * - positive numbers if it encountered parsing errors.
+ * - negative numbers if it failed to parse due the programming errors like invalid input.
+ */
+DRAFTER_API drafter_error drafter_parse_blueprint_n(
+    const char* source, size_t length, drafter_result** out, const drafter_parse_options parse_opts);
+
+/* Parse API Blueprint from a buffer of given length like
+ * drafter_parse_blueprint_n() and fill stats, if not NULL, with time
+ * spent in each parsing stage and work counters.
+ *
+ * Returns:
+ * - 0 if everything went smooth.
+ * - positive numbers if it encountered parsing errors.
+ * - negative numbers if it failed to parse due the programming errors like invalid input.
+ */
+DRAFTER_API drafter_error drafter_parse_blueprint_with_stats(const char* source,
+    size_t length,
+    drafter_result** out,
+    const drafter_parse_options parse_opts,
+    drafter_parse_stats* stats);
+
+/* Parse API Blueprint from a buffer of given length like
+ * drafter_parse_blueprint_with_stats(), converting it as set by
+ * conversion_opts. Default conversion options are used if conversion_opts
+ * is NULL.
+ *
+ * Returns:
+ * - 0 if everything went smooth.
+ * - positive numbers if it encountered parsing errors.
+ * - negative numbers if it failed to parse due the programming errors like invalid input.
+ */
+DRAFTER_API drafter_error drafter_parse_blueprint_with_options(const char* source,
+    size_t length,
+    drafter_result** out,
+    const drafter_parse_options parse_opts,
+    const drafter_conversion_options* conversion_opts,
+    drafter_parse_stats* stats);
+
 /* Serialize result to given format, returns NULL if an error is encountered */
 DRAFTER_API char* drafter_serialize(drafter_result* res, const drafter_serialize_options serialize_opts);
 
+/* Writer callback for drafter_serialize_to().
+ * - data : chunk of serialized output, it is not NUL-terminated
+ * - size : length of chunk in bytes
+ * - user_data : pointer passed to drafter_serialize_to()
+ * Returns number of bytes written, anything less than size stops serialization.
+ */
+typedef size_t (*drafter_write_cb)(const char* data, size_t size, void* user_data);
+
+/* Serialize result to given format, passing output in chunks to writer
+ * instead of building it in memory.
+ * Returns:
+ * - 0 if output was serialized completely.
+ * - DRAFTER_EINVALID_INPUT if result is NULL or format is unknown.
+ * - DRAFTER_EINVALID_OUTPUT if writer is NULL or it failed to write a chunk.
+ */
+DRAFTER_API drafter_error drafter_serialize_to(drafter_result* res,
+    const drafter_serialize_options serialize_opts,
+    drafter_write_cb write,
+    void* user_data);
+
 /* Free memory allocated for result handler */
 DRAFTER_API void drafter_free_result(drafter_result* res);
 
 /* Parse API Blueprint and return only annotations.
+ * Annotations are equal to those of drafter_parse_blueprint(), but message
+ * bodies and schemas are not generated and every top level element of the
+ * API description is dropped as soon as it is converted, so validation is
+ * cheaper than full parse.
  * Returns:
  * - 0 if everything went smooth.
  * - positive numbers if it encountered parsing errors, which are described in the result
@@ -128,6 +276,74 @@ DRAFTER_API void drafter_free_result(drafter_result* res);
 DRAFTER_API drafter_error drafter_check_blueprint(
     const char* source, drafter_result** res, const drafter_parse_options parse_opts);
 
+/* Check API Blueprint from a buffer of given length like
+ * drafter_check_blueprint(). Source does not have to be NUL-terminated,
+ * see drafter_parse_blueprint_n().
+ */
+DRAFTER_API drafter_error drafter_check_blueprint_n(
+    const char* source, size_t length, drafter_result** res, const drafter_parse_options parse_opts);
+
+/* Parse several independent API Blueprints concurrently.
+ * - sources : array of count NUL-terminated sources
+ * - threads : number of worker threads, 0 to use number of cores
+ * - results : array of count pointers, each is set to result of
+ *   corresponding source, to be released by drafter_free_result()
+ * - errors : optional array of count codes, each is set to the code
+ *   drafter_parse_blueprint() would return for corresponding source
+ *
+ * Returns:
+ * - 0 if all sources were parsed without errors.
+ * - highest positive code if any source encountered parsing errors.
+ * - negative numbers if any source failed to parse due to programming
+ *   errors like invalid input.
+ */
+DRAFTER_API drafter_error drafter_parse_many(const char* const* sources,
+    size_t count,
+    unsigned int threads,
+    drafter_result** results,
+    drafter_error* errors,
+    const drafter_parse_options parse_opts);
+
+/* Create a parser session.
+ *
+ * Session keeps the markdown parser, its sundown renderer and the
+ * renderer's output buffer between drafter_session_parse() calls, which
+ * saves the per-document setup cost when many blueprints are parsed in
+ * a row. Compiled regular expressions are cached per thread, not per
+ * session.
+ *
+ * Session is not thread safe. Use one session per thread, never share
+ * a session between threads without external synchronization.
+ *
+ * Returns NULL if session can not be created.
+ */
+DRAFTER_API drafter_session* drafter_session_new(void);
+
+/* Parse API Blueprint using resources held by session.
+ * Result is equal to drafter_parse_blueprint() and has to be released
+ * by drafter_free_result(), independently on session lifetime.
+ *
+ * Returns:
+ * - 0 if everything went smooth.
+ * - positive numbers if it encountered parsing errors.
+ * - negative numbers if it failed to parse due the programming errors like invalid input.
+ */
+DRAFTER_API drafter_error drafter_session_parse(
+    drafter_session* session, const char* source, drafter_result** out, const drafter_parse_options parse_opts);
+
+/* Parse API Blueprint from a buffer of given length using resources held
+ * by session. Source does not have to be NUL-terminated, see
+ * drafter_parse_blueprint_n().
+ */
+DRAFTER_API drafter_error drafter_session_parse_n(drafter_session* session,
+    const char* source,
+    size_t length,
+    drafter_result** out,
+    const drafter_parse_options parse_opts);
+
+/* Free parser session */
+DRAFTER_API void drafter_session_free(drafter_session* session);
+
 DRAFTER_API unsigned int drafter_version(void);
 
 DRAFTER_API const char* drafter_version_string(void);
@@ -0,0 +1,107 @@
+//
+//  input.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "input.h"
+
+#include <cstdio>
+#include <fstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+InputBuffer::~InputBuffer()
+{
+#if !defined(_WIN32)
+    if (mapping_) {
+        ::munmap(mapping_, size_);
+    }
+#endif
+}
+
+bool InputBuffer::map(const std::string& file)
+{
+#if defined(_WIN32)
+    return false;
+#else
+    int fd = ::open(file.c_str(), O_RDONLY);
+
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+
+    // empty files can not be mapped, leave them and non regular files to read()
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* mapping = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    ::madvise(mapping, info.st_size, MADV_SEQUENTIAL);
+
+    mapping_ = mapping;
+    data_ = static_cast<const char*>(mapping);
+    size_ = info.st_size;
+
+    return true;
+#endif
+}
+
+bool InputBuffer::read(const std::string& file)
+{
+    static const size_t ChunkSize = 64 * 1024;
+
+    if (file.empty()) {
+        char chunk[ChunkSize];
+        size_t length;
+
+        while ((length = std::fread(chunk, 1, ChunkSize, stdin)) > 0) {
+            owned_.append(chunk, length);
+        }
+
+        if (std::ferror(stdin)) {
+            return false;
+        }
+    } else {
+        std::ifstream in(file.c_str(), std::ios_base::in | std::ios_base::binary);
+
+        if (!in.is_open()) {
+            return false;
+        }
+
+        char chunk[ChunkSize];
+
+        while (in.read(chunk, ChunkSize) || in.gcount() > 0) {
+            owned_.append(chunk, in.gcount());
+        }
+    }
+
+    data_ = owned_.data();
+    size_ = owned_.size();
+
+    return true;
+}
+
+bool InputBuffer::open(const std::string& file)
+{
+    if (!file.empty() && map(file)) {
+        return true;
+    }
+
+    return read(file);
+}
@@ -0,0 +1,58 @@
+//
+//  input.h
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_INPUT_H
+#define DRAFTER_INPUT_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ *  \brief read-only view of CLI input data
+ *
+ *  Regular files are memory mapped, anything else (stdin, pipes) is read
+ *  into a single owned buffer. Data is not NUL-terminated, pass it to
+ *  drafter_parse_blueprint_n(), which parses it in place.
+ */
+class InputBuffer
+{
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+
+    void* mapping_ = nullptr; // mapped region, nullptr if data are owned
+    std::string owned_;
+
+    bool map(const std::string& file);
+    bool read(const std::string& file);
+
+public:
+    InputBuffer() = default;
+    ~InputBuffer();
+
+    InputBuffer(const InputBuffer&) = delete;
+    InputBuffer& operator=(const InputBuffer&) = delete;
+
+    /**
+     *  \brief open input
+     *
+     *  \param file name of file to read, if empty read standard input
+     *  \return false if input could not be read
+     */
+    bool open(const std::string& file);
+
+    const char* data() const noexcept
+    {
+        return data_;
+    }
+
+    size_t size() const noexcept
+    {
+        return size_;
+    }
+};
+
+#endif // #ifndef DRAFTER_INPUT_H
@@ -15,6 +15,8 @@
 
 #include "reporting.h"
 #include "config.h"
+#include "batch.h"
+#include "input.h"
 #include "stream.h"
 
 #include "ConversionContext.h"
@@ -23,14 +25,21 @@
 
 namespace sc = snowcrash;
 
-int ProcessRefract(const Config& config, std::unique_ptr<std::istream>& in, std::unique_ptr<std::ostream>& out)
+namespace
+{
+    size_t WriteToStream(const char* data, size_t size, void* user_data)
+    {
+        std::ostream& out = *static_cast<std::ostream*>(user_data);
+        out.write(data, size);
+        return out ? size : 0;
+    }
+}
+
+int ProcessRefract(const Config& config, const InputBuffer& in, std::unique_ptr<std::ostream>& out)
 {
     if (config.enableLog)
         ENABLE_LOGGING;
 
-    std::stringstream inputStream;
-    inputStream << in->rdbuf();
-
     drafter_serialize_options options;
     options.sourcemap = config.sourceMap;
     options.format = config.format == drafter::YAMLFormat ? DRAFTER_SERIALIZE_YAML : DRAFTER_SERIALIZE_JSON;
@@ -40,23 +49,29 @@ int ProcessRefract(const Config& config, std::unique_ptr<std::istream>& in, std:
     // TODO: Read parse options from CLI
     drafter_parse_options parseOptions = { false };
 
-    int ret = drafter_parse_blueprint(inputStream.str().c_str(), &result, parseOptions);
+    drafter_conversion_options conversionOptions;
+    conversionOptions.size = sizeof(conversionOptions);
+    conversionOptions.threads = config.threads;
+
+    drafter_parse_stats stats;
+    int ret = drafter_parse_blueprint_with_options(
+        in.data(), in.size(), &result, parseOptions, &conversionOptions, config.stats ? &stats : nullptr);
 
     if (!result) {
         return -1;
     }
 
     if (!config.validate) { // If not validate, we serialize
-        char* output = drafter_serialize(result, options);
-
-        if (output) {
-            *out << output << "\n" << std::flush;
-
-            free(output);
+        if (drafter_serialize_to(result, options, &WriteToStream, out.get()) == DRAFTER_OK) {
+            *out << "\n" << std::flush;
         }
     }
 
-    PrintReport(result, inputStream.str(), config.lineNumbers, ret);
+    PrintReport(result, in.data(), in.size(), config.lineNumbers, ret);
+
+    if (config.stats) {
+        PrintStats(stats);
+    }
 
     drafter_free_result(result);
 
@@ -68,7 +83,18 @@ int main(int argc, const char* argv[])
     Config config;
     ParseCommadLineOptions(argc, argv, config);
 
-    std::unique_ptr<std::istream> in(CreateStreamFromName<std::istream>(config.input));
+    if (config.batch) {
+        std::unique_ptr<std::ostream> out(CreateStreamFromName<std::ostream>(config.output));
+        return ProcessBatch(config, *out);
+    }
+
+    InputBuffer in;
+
+    if (!in.open(config.input)) {
+        std::cerr << "fatal: unable to open file '" << config.input << "'\n";
+        return EXIT_FAILURE;
+    }
+
     std::unique_ptr<std::ostream> out(CreateStreamFromName<std::ostream>(config.output));
 
     return ProcessRefract(config, in, out);
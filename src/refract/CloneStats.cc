@@ -0,0 +1,39 @@
+//
+//  refract/CloneStats.cc
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#include "CloneStats.h"
+
+using namespace refract;
+
+namespace
+{
+    thread_local CloneStats counters;
+}
+
+CloneStats& CloneStats::operator+=(const CloneStats& other) noexcept
+{
+    elements += other.elements;
+    data += other.data;
+
+    return *this;
+}
+
+CloneStats& refract::detail::threadCloneStats() noexcept
+{
+    return counters;
+}
+
+CloneScope::CloneScope() noexcept : start_(counters) {}
+
+CloneStats CloneScope::get() const noexcept
+{
+    CloneStats stats;
+
+    stats.elements = counters.elements - start_.elements;
+    stats.data = counters.data - start_.data;
+
+    return stats;
+}
@@ -0,0 +1,50 @@
+//
+//  refract/CloneStats.h
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#ifndef REFRACT_CLONESTATS_H
+#define REFRACT_CLONESTATS_H
+
+#include <cstddef>
+
+namespace refract
+{
+    ///
+    /// Copies of Elements made by a thread
+    ///
+    struct CloneStats {
+        std::size_t elements = 0; //< Elements created by IElement::clone()
+        std::size_t data = 0;     //< DSDs copied because a shared DSD was modified
+
+        CloneStats& operator+=(const CloneStats& other) noexcept;
+    };
+
+    namespace detail
+    {
+        ///
+        /// Counters of current thread, incremented by Element and CopyOnWrite
+        ///
+        CloneStats& threadCloneStats() noexcept;
+    }
+
+    ///
+    /// Measure copies made by current thread during lifetime of the scope
+    ///
+    class CloneScope
+    {
+        CloneStats start_;
+
+    public:
+        CloneScope() noexcept;
+
+        CloneScope(const CloneScope&) = delete;
+        CloneScope& operator=(const CloneScope&) = delete;
+
+        /// Copies made since the scope was entered
+        CloneStats get() const noexcept;
+    };
+}
+
+#endif // #ifndef REFRACT_CLONESTATS_H
@@ -0,0 +1,92 @@
+//
+//  refract/CopyOnWrite.h
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#ifndef REFRACT_COPYONWRITE_H
+#define REFRACT_COPYONWRITE_H
+
+#include <memory>
+
+#include "CloneStats.h"
+
+namespace refract
+{
+    ///
+    /// Value shared by all its copies until one of them is modified
+    ///
+    /// Copying is constant time, the value is copied on the first call
+    /// to mutate() while it is shared. Copies can be used from several
+    /// threads as long as each of them is modified by a single thread.
+    ///
+    template <typename T>
+    class CopyOnWrite
+    {
+        std::shared_ptr<T> value_;
+
+        static const T& empty()
+        {
+            static const T value{};
+            return value;
+        }
+
+    public:
+        CopyOnWrite() = default;
+
+        explicit CopyOnWrite(T value) : value_(std::make_shared<T>(std::move(value))) {}
+
+        const T& get() const noexcept
+        {
+            return value_ ? *value_ : empty();
+        }
+
+        T& mutate()
+        {
+            if (!value_) {
+                value_ = std::make_shared<T>();
+            } else if (value_.use_count() > 1) {
+                value_ = std::make_shared<T>(*value_);
+                ++detail::threadCloneStats().data;
+            }
+
+            return *value_;
+        }
+
+        bool shared() const noexcept
+        {
+            return value_.use_count() > 1;
+        }
+    };
+
+    ///
+    /// Value held in place, copied with its owner
+    ///
+    template <typename T>
+    class InPlace
+    {
+        T value_ = {};
+
+    public:
+        InPlace() = default;
+
+        explicit InPlace(T value) : value_(std::move(value)) {}
+
+        const T& get() const noexcept
+        {
+            return value_;
+        }
+
+        T& mutate() noexcept
+        {
+            return value_;
+        }
+
+        bool shared() const noexcept
+        {
+            return false;
+        }
+    };
+}
+
+#endif // #ifndef REFRACT_COPYONWRITE_H
@@ -15,7 +15,6 @@
 #include <array>
 
 #include "ComparableVisitor.h"
-#include "TypeQueryVisitor.h"
 
 using namespace refract;
 
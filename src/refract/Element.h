@@ -14,6 +14,8 @@
 #include "dsd/ElementData.h"
 #include "dsd/Traits.h"
 
+#include "CloneStats.h"
+#include "CopyOnWrite.h"
 #include "ElementIfc.h"
 #include "InfoElements.h"
 #include "Visitor.h"
@@ -24,22 +26,37 @@ namespace refract
     ///
     /// Refract Element definition
     ///
+    /// DSD owning nested Elements is shared by clones of the Element
+    /// until one of them modifies it by mutate() or set(). Cloning an
+    /// Element copies its meta and attributes but not its subtree.
+    ///
     /// @tparam DataType    Data structure definition (DSD) of the Refract Element
     ///
     template <typename DataType>
     class Element final : public IElement
     {
+        using Storage = typename std::
+            conditional<dsd::has_children<DataType>::value, CopyOnWrite<DataType>, InPlace<DataType> >::type;
+
         InfoElements meta_ = {};       //< Refract Element meta
         InfoElements attributes_ = {}; //< Refract Element attributes
 
         bool hasValue_ = false; //< Whether DSD is set
-        DataType data_ = {};    //< DSD
+        Storage data_ = {};     //< DSD
+
+        Symbol name_ = defaultName(); //< Name of the Element
 
-        std::string name_ = DataType::name; //< Name of the Element
+        static Symbol defaultName()
+        {
+            static const Symbol name(DataType::name);
+            return name;
+        }
 
     public:
         using ValueType = DataType; //< DSD type definition
 
+        static constexpr ElementKind Kind = dsd::kind_of<DataType>::value; //< DSD type tag
+
     public:
         ///
         /// Initialize a Refract Element with empty DSD
@@ -51,12 +68,12 @@ namespace refract
         /// Initialize a Refract Element from a DSD
         /// @remark sets name of the element to DataType::name
         ///
-        explicit Element(DataType data) : hasValue_(true), data_(std::move(data)), name_(DataType::name) {}
+        explicit Element(DataType data) : hasValue_(true), data_(std::move(data)) {}
 
         ///
         /// Initialize a Refract Element from given name and DSD
         ///
-        Element(const std::string& name, DataType data) : hasValue_(true), data_(data), name_(name) {}
+        Element(Symbol name, DataType data) : hasValue_(true), data_(std::move(data)), name_(name) {}
 
         Element(Element&&) = default;
         Element(const Element&) = default;
@@ -65,22 +82,33 @@ namespace refract
         Element& operator=(const Element&) = default;
 
     public:
-        DataType& get() noexcept
+        ///
+        /// Read the DSD
+        /// @remark never copies the DSD, even if it is shared with a clone
+        ///
+        const DataType& get() const noexcept
         {
             assert(hasValue_);
-            return data_;
+            return data_.get();
         }
 
-        const DataType& get() const noexcept
+        ///
+        /// Access the DSD for modification
+        /// @remark copies the DSD if it is shared with a clone
+        ///
+        /// The reference must not be kept across clone() of the Element,
+        /// the DSD it refers to is shared with the clone afterwards.
+        ///
+        DataType& mutate()
         {
             assert(hasValue_);
-            return data_;
+            return data_.mutate();
         }
 
         void set(DataType data = {})
         {
             hasValue_ = true;
-            data_ = data;
+            data_ = Storage(std::move(data));
         }
 
     public: // IElement
@@ -104,12 +132,17 @@ namespace refract
             return attributes_;
         }
 
-        std::string element() const override
+        Symbol element() const noexcept override
         {
             return name_;
         }
 
-        void element(const std::string& name) override
+        ElementKind kind() const noexcept override
+        {
+            return Kind;
+        }
+
+        void element(Symbol name) override
         {
             name_ = name;
         }
@@ -126,6 +159,8 @@ namespace refract
 
         std::unique_ptr<IElement> clone(int flags = IElement::cAll) const override
         {
+            ++detail::threadCloneStats().elements;
+
             auto el = std::make_unique<Element>();
 
             if (flags & IElement::cElement)
@@ -135,7 +170,7 @@ namespace refract
             if (flags & IElement::cMeta) {
                 el->meta_ = meta_; // FIXME use copy_if rather than full copy with remove
                 if (flags & IElement::cNoMetaId)
-                    el->meta_.erase("id");
+                    el->meta_.erase(sym::id);
             }
             if (flags & IElement::cValue) {
                 el->hasValue_ = hasValue_;
@@ -151,6 +186,9 @@ namespace refract
         }
     };
 
+    template <typename DataType>
+    constexpr ElementKind Element<DataType>::Kind;
+
     ///
     /// Create an empty Element of given type
     /// @remark an empty Element has an empty data structure definition (DSD)
@@ -182,12 +220,17 @@ namespace refract
     auto generate_element(ContentVisitor visit, Args&&... visitorArgs)
     {
         auto element = make_element<ElementT>();
-        visit(element->get(), std::forward<Args>(visitorArgs)...);
+        visit(element->mutate(), std::forward<Args>(visitorArgs)...);
         return element;
     }
 
     bool isReserved(const char* w) noexcept;
     bool isReserved(const std::string& w) noexcept;
+
+    inline bool isReserved(Symbol w) noexcept
+    {
+        return sym::isReserved(w);
+    }
 }
 
 #endif
@@ -9,6 +9,28 @@
 #ifndef REFRACT_ELEMENTFWD_H
 #define REFRACT_ELEMENTFWD_H
 
+#include <cstdint>
+#include <type_traits>
+
+///
+/// Data structure definitions (DSD) of Refract Elements
+///
+#define REFRACT_ELEMENT_KINDS(X)                                                                                       \
+    X(Null)                                                                                                            \
+    X(Holder)                                                                                                          \
+    X(String)                                                                                                          \
+    X(Number)                                                                                                          \
+    X(Boolean)                                                                                                         \
+    X(Array)                                                                                                           \
+    X(Member)                                                                                                          \
+    X(Object)                                                                                                          \
+    X(Enum)                                                                                                            \
+    X(Ref)                                                                                                             \
+    X(Extend)                                                                                                          \
+    X(Option)                                                                                                          \
+    X(Select)                                                                                                          \
+    X(SourceMap)
+
 namespace refract
 {
     namespace dsd
@@ -26,6 +48,34 @@ namespace refract
         class Extend;
         class Option;
         class Select;
+        class SourceMap;
+    }
+
+    ///
+    /// Type of the DSD of an Element, see IElement::kind()
+    ///
+#define REFRACT_ELEMENT_KIND(DSD) DSD,
+    enum class ElementKind : std::uint8_t
+    {
+        Unknown = 0, //< not an Element<DSD>
+        REFRACT_ELEMENT_KINDS(REFRACT_ELEMENT_KIND)
+    };
+#undef REFRACT_ELEMENT_KIND
+
+    namespace dsd
+    {
+        ///
+        /// ElementKind of a DSD
+        ///
+        template <typename DataType>
+        struct kind_of;
+
+#define REFRACT_KIND_OF(DSD)                                                                                           \
+    template <>                                                                                                        \
+    struct kind_of<DSD> : std::integral_constant<ElementKind, ElementKind::DSD> {                                      \
+    };
+        REFRACT_ELEMENT_KINDS(REFRACT_KIND_OF)
+#undef REFRACT_KIND_OF
     }
 
     template <typename>
@@ -48,6 +98,8 @@ namespace refract
 
     using OptionElement = Element<dsd::Option>;
     using SelectElement = Element<dsd::Select>;
+
+    using SourceMapElement = Element<dsd::SourceMap>;
 }
 
 #endif
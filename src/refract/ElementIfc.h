@@ -11,6 +11,10 @@
 
 #include <string>
 #include <memory>
+#include <type_traits>
+
+#include "ElementFwd.h"
+#include "Symbol.h"
 
 namespace refract
 {
@@ -67,16 +71,23 @@ namespace refract
         ///
         /// Query name of this Element
         ///
-        /// @return Element name
+        /// @return Element name, does not allocate
         ///
-        virtual std::string element() const = 0;
+        virtual Symbol element() const noexcept = 0;
 
         ///
         /// Set name of this Element
         ///
         /// @param new name
         ///
-        virtual void element(const std::string&) = 0;
+        virtual void element(Symbol) = 0;
+
+        ///
+        /// Query type of the data structure representation (DSD) of this Element
+        ///
+        /// @return kind of DSD, does not visit
+        ///
+        virtual ElementKind kind() const noexcept = 0;
 
         ///
         /// Visit the data structure representation (DSD) of this Element
@@ -125,6 +136,29 @@ namespace refract
     {
         return std::unique_ptr<ElementT>(static_cast<ElementT*>(el.clone(flags).release()));
     }
+
+    ///
+    /// Downcast an Element to given Element type
+    ///
+    /// @param el   Element to be cast, may be nullptr
+    ///
+    /// @returns the Element if it is of given type, nullptr otherwise
+    ///
+    template <typename ElementT>
+    ElementT* dyn_cast(IElement* el) noexcept
+    {
+        using Target = typename std::remove_const<ElementT>::type;
+
+        return el && el->kind() == Target::Kind ? static_cast<ElementT*>(el) : nullptr;
+    }
+
+    template <typename ElementT>
+    const ElementT* dyn_cast(const IElement* el) noexcept
+    {
+        using Target = typename std::remove_const<ElementT>::type;
+
+        return el && el->kind() == Target::Kind ? static_cast<const ElementT*>(el) : nullptr;
+    }
 }
 
 #endif
@@ -10,6 +10,7 @@
 
 #include "../utils/log/Trivial.h"
 #include "Element.h"
+#include "Iterate.h"
 #include "Utils.h"
 
 #include <algorithm>
@@ -101,7 +102,7 @@ bool refract::inheritsFixed(const ExtendElement& e)
 
 bool refract::hasTypeAttr(const IElement& e, const char* name)
 {
-    auto typeAttrIt = e.attributes().find("typeAttributes");
+    auto typeAttrIt = e.attributes().find(sym::typeAttributes);
 
     if (typeAttrIt != e.attributes().end())
         if (const auto* typeAttrs = get<const ArrayElement>(typeAttrIt->second.get())) {
@@ -142,7 +143,7 @@ bool refract::hasNullableTypeAttr(const IElement& e)
 
 bool refract::isVariable(const IElement& e)
 {
-    const auto it = e.attributes().find("variable");
+    const auto it = e.attributes().find(sym::variable);
     if (it == e.attributes().end())
         return false;
 
@@ -201,9 +202,9 @@ void refract::setFixedTypeAttribute(IElement& e)
 
 void refract::setTypeAttribute(IElement& e, const std::string& typeAttribute)
 {
-    auto typeAttrIt = e.attributes().find("typeAttributes");
+    auto typeAttrIt = e.attributes().find(sym::typeAttributes);
     if (e.attributes().end() == typeAttrIt) {
-        e.attributes().set("typeAttributes", make_element<ArrayElement>(from_primitive(typeAttribute)));
+        e.attributes().set(sym::typeAttributes, make_element<ArrayElement>(from_primitive(typeAttribute)));
     } else {
         if (auto* typeAttrs = get<ArrayElement>(typeAttrIt->second.get())) {
             const auto b = typeAttrs->get().begin();
@@ -212,7 +213,7 @@ void refract::setTypeAttribute(IElement& e, const std::string& typeAttribute)
                     const auto* entry = get<const StringElement>(el.get());
                     return entry && !entry->empty() && (entry->get().get() == typeAttribute);
                 })) {
-                typeAttrs->get().push_back(from_primitive(typeAttribute));
+                typeAttrs->mutate().push_back(from_primitive(typeAttribute));
             }
         }
     }
@@ -220,23 +221,23 @@ void refract::setTypeAttribute(IElement& e, const std::string& typeAttribute)
 
 void refract::setDefault(IElement& e, std::unique_ptr<IElement> deflt)
 {
-    e.attributes().set("default", std::move(deflt));
+    e.attributes().set(sym::default_, std::move(deflt));
 }
 
 void refract::addSample(IElement& e, std::unique_ptr<IElement> sample)
 {
-    auto it = e.attributes().find("samples");
+    auto it = e.attributes().find(sym::samples);
     if (it == e.attributes().end()) {
         LOG(info) << "creating new samples entry";
-        e.attributes().set("samples", make_element<ArrayElement>(std::move(sample)));
+        e.attributes().set(sym::samples, make_element<ArrayElement>(std::move(sample)));
     } else if (ArrayElement* samples = get<ArrayElement>(it->second.get())) {
         if (samples->empty()) {
             LOG(error) << "empty Array Element in samples";
             assert(false);
         }
         LOG(info) << "adding new sample";
-        e.attributes().set("samples", make_element<ArrayElement>(std::move(sample)));
-        samples->get().push_back(std::move(sample));
+        e.attributes().set(sym::samples, make_element<ArrayElement>(std::move(sample)));
+        samples->mutate().push_back(std::move(sample));
     } else {
         LOG(error) << "expected samples to be held in Array Element content";
         assert(false);
@@ -245,15 +246,15 @@ void refract::addSample(IElement& e, std::unique_ptr<IElement> sample)
 
 void refract::addEnumeration(IElement& e, std::unique_ptr<IElement> enm)
 {
-    auto it = e.attributes().find("enumerations");
+    auto it = e.attributes().find(sym::enumerations);
     if (it == e.attributes().end())
-        e.attributes().set("enumerations", make_element<ArrayElement>(std::move(enm)));
+        e.attributes().set(sym::enumerations, make_element<ArrayElement>(std::move(enm)));
     else if (ArrayElement* enums = get<ArrayElement>(it->second.get())) {
         if (enums->empty()) {
             LOG(error) << "empty Array Element in enumerations";
             assert(false);
         }
-        enums->get().push_back(std::move(enm));
+        enums->mutate().push_back(std::move(enm));
     } else {
         LOG(error) << "expected enumerations to be held in Array Element content";
         assert(false);
@@ -262,7 +263,7 @@ void refract::addEnumeration(IElement& e, std::unique_ptr<IElement> enm)
 
 const IElement* refract::findFirstSample(const IElement& e)
 {
-    auto it = e.attributes().find("samples");
+    auto it = e.attributes().find(sym::samples);
     if (it != e.attributes().end()) {
         if (const auto& samples = get<const ArrayElement>(it->second.get()))
             if (!samples->empty() && !samples->get().empty())
@@ -273,7 +274,7 @@ const IElement* refract::findFirstSample(const IElement& e)
 
 const IElement* refract::findDefault(const IElement& e)
 {
-    auto it = e.attributes().find("default");
+    auto it = e.attributes().find(sym::default_);
     if (it != e.attributes().end())
         return it->second.get();
     return nullptr;
@@ -294,3 +295,35 @@ bool refract::definesValue(const IElement& e)
 {
     return nullptr != findValue(e);
 }
+
+namespace
+{
+    struct ElementCounter {
+        std::size_t count = 0;
+
+        void countInfo(const InfoElements& info)
+        {
+            for (const auto& entry : info) {
+                if (entry.second)
+                    count += countElements(*entry.second);
+            }
+        }
+
+        template <typename T>
+        void operator()(const T& element)
+        {
+            ++count;
+            countInfo(element.meta());
+            countInfo(element.attributes());
+        }
+    };
+}
+
+std::size_t refract::countElements(const IElement& e)
+{
+    ElementCounter counter;
+    Iterate<Recursive> iterate(counter);
+    iterate(e);
+
+    return counter.count;
+}
@@ -9,6 +9,8 @@
 #ifndef REFRACT_ELEMENT_UTILS_H
 #define REFRACT_ELEMENT_UTILS_H
 
+#include <cstddef>
+
 #include "ElementIfc.h"
 #include "ElementFwd.h"
 
@@ -132,6 +134,14 @@ namespace refract
 
     bool definesValue(const IElement& e);
 
+    ///
+    /// Count Elements of a tree
+    ///
+    /// @returns    number of given Element and all Elements nested in it,
+    ///             including its meta and attributes
+    ///
+    std::size_t countElements(const IElement& e);
+
 } // namespace refract
 
 namespace refract
@@ -26,6 +26,11 @@ namespace refract
         explicit Deprecated(const std::string& msg) : std::logic_error(msg) {}
     };
 
+    // expansion produced more Elements than its limit allows
+    struct ExpansionLimitExceeded : std::runtime_error {
+        explicit ExpansionLimitExceeded(const std::string& msg) : std::runtime_error(msg) {}
+    };
+
 }; // namespace refract
 
 #endif // #ifndef REFRACT_EXCEPTION_H
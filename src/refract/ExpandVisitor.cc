@@ -7,8 +7,11 @@
 //
 
 #include "Element.h"
+#include "Exception.h"
 #include "Registry.h"
+#include <algorithm>
 #include <stack>
+#include <vector>
 
 #include <functional>
 
@@ -18,7 +21,6 @@
 
 #include "IsExpandableVisitor.h"
 #include "ExpandVisitor.h"
-#include "TypeQueryVisitor.h"
 #include "VisitorUtils.h"
 
 #define VISIT_IMPL(ELEMENT)                                                                                            \
@@ -42,18 +44,18 @@ namespace refract
 
         void CopyMetaId(IElement& dst, const IElement& src)
         {
-            auto name = src.meta().find("id");
+            auto name = src.meta().find(sym::id);
             if (name != src.meta().end() && name->second && !name->second->empty()) {
-                dst.meta().set("id", name->second->clone());
+                dst.meta().set(sym::id, name->second->clone());
             }
         }
 
         void MetaIdToRef(IElement& e)
         {
-            auto name = e.meta().find("id");
+            auto name = e.meta().find(sym::id);
             if (name != e.meta().end() && name->second && !name->second->empty()) {
-                e.meta().set("ref", name->second->clone());
-                e.meta().erase("id");
+                e.meta().set(sym::ref, name->second->clone());
+                e.meta().erase(sym::id);
             }
         }
 
@@ -104,22 +106,24 @@ namespace refract
         std::unique_ptr<ExtendElement> GetInheritanceTree(const std::string& name, const Registry& registry)
         {
             std::stack<std::unique_ptr<IElement> > inheritance;
-            std::string en = name;
 
-            // FIXME: add check against recursive inheritance
-            // walk recursive in registry and expand inheritance tree
-            for (const IElement* parent = registry.find(en); parent && !isReserved(en);
-                 en = parent->element(), parent = registry.find(en)) {
+            // walk the inheritance chain in registry and expand inheritance tree
+            for (const Registry::Type* type = registry.findType(name); type; type = registry.findParent(*type)) {
 
-                inheritance.push(clone(*parent, ((IElement::cAll ^ IElement::cElement) | IElement::cNoMetaId)));
-                inheritance.top()->meta().set("ref", from_primitive(en));
+                // a frozen registry has no cycles, an unfrozen one is not checked
+                if (inheritance.size() == registry.size())
+                    throw snowcrash::Error(
+                        "base type '" + name + "' circularly referencing itself", snowcrash::MSONError);
+
+                inheritance.push(clone(*type->element, ((IElement::cAll ^ IElement::cElement) | IElement::cNoMetaId)));
+                inheritance.top()->meta().set(sym::ref, from_primitive(type->name));
             }
 
             if (inheritance.empty())
                 return make_empty<ExtendElement>();
 
             auto e = make_element<ExtendElement>();
-            auto& content = e->get();
+            auto& content = e->mutate();
 
             do {
                 content.push_back(std::move(inheritance.top()));
@@ -141,16 +145,112 @@ namespace refract
 
         const Registry& registry;
         ExpandVisitor* expand;
-        std::deque<std::string> members;
+        ExpansionCache* cache;
+        std::deque<Symbol> members;
+
+        const std::size_t limit; // 0 if unlimited
+        std::size_t produced = 0;
+
+        // named types looked up since the outermost memoized expansion
+        // started, see Memoized()
+        std::vector<Symbol> encountered;
+
+        Context(const Registry& registry, ExpandVisitor* expand, ExpansionCache* cache, std::size_t limit)
+            : registry(registry), expand(expand), cache(cache), limit(limit)
+        {
+        }
+
+        // account Elements put into the expanded tree, name is the named
+        // type they belong to if it is not being expanded yet
+        void Produce(std::size_t count, Symbol name = Symbol())
+        {
+            produced += count;
+
+            if (limit && produced > limit) {
+                std::stringstream msg;
+
+                if (!members.empty()) {
+                    msg << "named type '" << members.front().str() << "'";
+                } else if (!name.empty()) {
+                    msg << "named type '" << name.str() << "'";
+                } else {
+                    msg << "data structure";
+                }
+
+                msg << " expands to more than " << limit << " elements";
 
-        Context(const Registry& registry, ExpandVisitor* expand) : registry(registry), expand(expand) {}
+                throw ExpansionLimitExceeded(msg.str());
+            }
+        }
+
+        void Encounter(Symbol name)
+        {
+            if (cache)
+                encountered.push_back(name);
+        }
+
+        // expansion of types in dependencies is not cut short by a circular reference
+        bool Independent(const std::vector<Symbol>& dependencies) const
+        {
+            return std::none_of(dependencies.begin(), dependencies.end(), [this](Symbol name) {
+                return std::find(members.begin(), members.end(), name) != members.end();
+            });
+        }
 
-        std::unique_ptr<IElement> ExpandOrClone(const IElement* e) const
+        ///
+        /// Expand once, reuse clones of the result afterwards
+        ///
+        /// Expansion of a named type depends on which of the types it
+        /// refers to are being expanded by the caller, these are cut short
+        /// to break circular references. A result is stored with all types
+        /// it refers to and reused only if none of them is being expanded.
+        ///
+        template <typename T, typename Expand>
+        std::unique_ptr<T> Memoized(ExpansionCache::Map ExpansionCache::*map, Symbol name, Expand expand)
+        {
+            if (!cache) {
+                return expand();
+            }
+
+            auto& stored = cache->*map;
+
+            auto it = stored.find(name);
+            if (it != stored.end() && Independent(it->second.dependencies)) {
+                Produce(it->second.size, name);
+
+                const auto& dependencies = it->second.dependencies;
+                encountered.insert(encountered.end(), dependencies.begin(), dependencies.end());
+                return clone(static_cast<const T&>(*it->second.element));
+            }
+
+            const size_t start = encountered.size();
+            const size_t before = produced;
+
+            std::unique_ptr<T> result = expand();
+
+            std::vector<Symbol> dependencies(encountered.begin() + start, encountered.end());
+            std::sort(dependencies.begin(), dependencies.end());
+            dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+
+            encountered.resize(start);
+            encountered.insert(encountered.end(), dependencies.begin(), dependencies.end());
+
+            if (Independent(dependencies)) {
+                stored.emplace(
+                    name, ExpansionCache::Entry{ clone(*result), std::move(dependencies), produced - before });
+            }
+
+            return result;
+        }
+
+        std::unique_ptr<IElement> ExpandOrClone(const IElement* e)
         {
             if (!e) {
                 return nullptr;
             }
 
+            Produce(1);
+
             VisitBy(*e, *expand);
             auto result = expand->get();
 
@@ -186,6 +286,8 @@ namespace refract
         std::unique_ptr<IElement> ExpandNamedType(const T& e)
         {
 
+            Encounter(e.element());
+
             // Look for Circular Reference thro members
             if (std::find(members.begin(), members.end(), e.element()) != members.end()) {
                 // To avoid unfinised recursion just clone
@@ -196,25 +298,26 @@ namespace refract
 
                 auto result = clone(*root, IElement::cMeta | IElement::cAttributes | IElement::cNoMetaId);
 
-                result->meta().set("ref", from_primitive(e.element()));
+                result->meta().set(sym::ref, from_primitive(e.element()));
 
                 return result;
             }
 
-            members.push_back(e.element());
-
-            auto extend = ExpandMembers(*GetInheritanceTree(e.element(), registry));
+            auto extend = Memoized<ExtendElement>(&ExpansionCache::inherited, e.element(), [this, &e]() {
+                members.push_back(e.element());
+                auto result = ExpandMembers(*GetInheritanceTree(e.element(), registry));
+                members.pop_back();
+                return result;
+            });
 
             CopyMetaId(*extend, e);
 
-            members.pop_back();
-
             auto origin = ExpandMembers(e);
-            origin->meta().erase("id");
+            origin->meta().erase(sym::id);
 
             if (extend->empty())
                 extend->set();
-            extend->get().push_back(std::move(origin));
+            extend->mutate().push_back(std::move(origin));
 
             return std::move(extend);
         }
@@ -228,7 +331,11 @@ namespace refract
                 return ref;
             }
 
-            if (std::find(members.begin(), members.end(), symbol) != members.end()) {
+            const Symbol name = symbol;
+
+            Encounter(name);
+
+            if (std::find(members.begin(), members.end(), name) != members.end()) {
 
                 std::stringstream msg;
                 msg << "named type '";
@@ -238,16 +345,17 @@ namespace refract
                 throw snowcrash::Error(msg.str(), snowcrash::MSONError);
             }
 
-            members.push_back(symbol);
-
             if (auto referenced = registry.find(symbol)) {
-                auto expanded = ExpandOrClone(std::move(referenced));
-                MetaIdToRef(*expanded);
-                ref->attributes().set("resolved", std::move(expanded));
+                ref->attributes().set(sym::resolved,
+                    Memoized<IElement>(&ExpansionCache::resolved, name, [this, name, referenced]() {
+                        members.push_back(name);
+                        auto expanded = ExpandOrClone(referenced);
+                        MetaIdToRef(*expanded);
+                        members.pop_back();
+                        return expanded;
+                    }));
             }
 
-            members.pop_back();
-
             return ref;
         }
     };
@@ -256,7 +364,7 @@ namespace refract
     struct ExpandElement {
         std::unique_ptr<IElement> operator()(const T& e, ExpandVisitor::Context* context)
         {
-            if (!isReserved(e.element().c_str())) { // expand named type
+            if (!isReserved(e.element())) { // expand named type
                 return context->ExpandNamedType(e);
             }
             return nullptr;
@@ -280,7 +388,7 @@ namespace refract
             }
 
             auto o = make_element<T>();
-            auto& content = o->get();
+            auto& content = o->mutate();
 
             o->meta() = e.meta(); // clone
 
@@ -301,9 +409,7 @@ namespace refract
                 return nullptr;
             }
 
-            std::string en = e.element();
-
-            if (!isReserved(en.c_str())) { // expand named type
+            if (!isReserved(e.element())) { // expand named type
                 return context->ExpandNamedType(e);
             } else { // walk throught members and expand them
                 return context->ExpandMembers(e);
@@ -337,7 +443,8 @@ namespace refract
         return ExpandElement<T>()(e, context);
     }
 
-    ExpandVisitor::ExpandVisitor(const Registry& registry) : result(nullptr), context(new Context(registry, this)){};
+    ExpandVisitor::ExpandVisitor(const Registry& registry, ExpansionCache* cache, std::size_t limit)
+        : result(nullptr), context(new Context(registry, this, cache, limit)){};
 
     ExpandVisitor::~ExpandVisitor()
     {
@@ -355,6 +462,9 @@ namespace refract
     // do nothing, NullElements are not expandable
     void ExpandVisitor::operator()(const NullElement& e) {}
 
+    // do nothing, SourceMapElements are not expandable
+    void ExpandVisitor::operator()(const SourceMapElement& e) {}
+
     VISIT_IMPL(String)
     VISIT_IMPL(Number)
     VISIT_IMPL(Boolean)
@@ -11,20 +11,59 @@
 
 #include "ElementFwd.h"
 #include "ElementIfc.h"
+#include "Symbol.h"
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace refract
 {
 
     class Registry;
 
+    ///
+    /// Expanded named types shared by ExpandVisitors
+    ///
+    /// Filled on first expansion of each named type and mixin, later
+    /// expansions clone the stored result. Valid as long as the Registry
+    /// it was filled from is not modified.
+    ///
+    struct ExpansionCache {
+        struct Entry {
+            std::unique_ptr<IElement> element;
+            std::vector<Symbol> dependencies; //< named types the expansion refers to
+            std::size_t size;                 //< Elements the expansion produced
+        };
+
+        using Map = std::unordered_map<Symbol, Entry>;
+
+        Map inherited; //< expanded inheritance chain of a named type
+        Map resolved;  //< expanded named type included as a mixin
+
+        std::size_t size() const noexcept
+        {
+            return inherited.size() + resolved.size();
+        }
+
+        void clear() noexcept
+        {
+            inherited.clear();
+            resolved.clear();
+        }
+    };
+
     class ExpandVisitor
     {
 
     public:
         struct Context;
 
-        ExpandVisitor(const Registry& registry);
+        ///
+        /// @param limit Elements an expansion may produce, 0 if unlimited;
+        ///     ExpansionLimitExceeded is thrown when it is exceeded. Clones
+        ///     of stored expansions count with their full size.
+        ///
+        ExpandVisitor(const Registry& registry, ExpansionCache* cache = nullptr, std::size_t limit = 0);
         ~ExpandVisitor();
 
         void operator()(const IElement& e);
@@ -35,6 +74,7 @@ namespace refract
         void operator()(const NumberElement& e);
         void operator()(const BooleanElement& e);
         void operator()(const HolderElement& e);
+        void operator()(const SourceMapElement& e);
 
         void operator()(const MemberElement& e);
 
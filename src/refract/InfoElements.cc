@@ -10,112 +10,159 @@
 
 #include <cassert>
 #include <algorithm>
+#include <limits>
+#include <new>
+#include <stdexcept>
 #include "Element.h"
 #include "dsd/ElementData.h"
-#include "TypeQueryVisitor.h"
 
 namespace refract
 {
-    InfoElements::InfoElements() : elements() {}
+    constexpr InfoElements::size_type InfoElements::InlineCapacity;
 
-    InfoElements::InfoElements(InfoElements&& other) : InfoElements()
-    {
-        swap(*this, other);
-    }
+    InfoElements::InfoElements() noexcept : data_(inlineData()) {}
 
-    InfoElements& InfoElements::operator=(InfoElements rhs)
+    InfoElements::~InfoElements()
     {
-        swap(*this, rhs);
-        return *this;
+        release();
     }
 
-    InfoElements::const_iterator InfoElements::begin() const noexcept
+    InfoElements::InfoElements(InfoElements&& other) noexcept : InfoElements()
     {
-        return elements.begin();
+        moveFrom(other);
     }
 
-    InfoElements::iterator InfoElements::begin() noexcept
+    InfoElements& InfoElements::operator=(InfoElements rhs)
     {
-        return elements.begin();
+        release();
+        moveFrom(rhs);
+        return *this;
     }
 
-    InfoElements::const_iterator InfoElements::end() const noexcept
+    void InfoElements::release() noexcept
     {
-        return elements.end();
+        clear();
+
+        if (!isInline()) {
+            ::operator delete(data_);
+            data_ = inlineData();
+            capacity_ = InlineCapacity;
+        }
     }
 
-    InfoElements::iterator InfoElements::end() noexcept
+    // `this` has to be empty and use inline storage
+    void InfoElements::moveFrom(InfoElements& other) noexcept
     {
-        return elements.end();
+        assert(empty() && isInline());
+
+        if (other.isInline()) {
+            for (size_type i = 0; i < other.size_; ++i) {
+                new (data_ + i) value_type(std::move(other.data_[i]));
+                other.data_[i].~value_type();
+            }
+            size_ = other.size_;
+        } else {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+
+            other.data_ = other.inlineData();
+            other.capacity_ = InlineCapacity;
+        }
+
+        other.size_ = 0;
     }
 
-    void InfoElements::erase(iterator it)
+    void InfoElements::reserve(size_type capacity)
     {
-        elements.erase(it);
+        if (capacity <= capacity_)
+            return;
+
+        if (capacity > std::numeric_limits<std::uint32_t>::max())
+            throw std::length_error("too many info elements");
+
+        auto data = static_cast<value_type*>(::operator new(capacity * sizeof(value_type)));
+
+        for (size_type i = 0; i < size_; ++i) {
+            new (data + i) value_type(std::move(data_[i]));
+            data_[i].~value_type();
+        }
+
+        if (!isInline())
+            ::operator delete(data_);
+
+        data_ = data;
+        capacity_ = static_cast<std::uint32_t>(capacity);
     }
 
-    void InfoElements::clear()
+    void InfoElements::emplace_back(Symbol key, std::unique_ptr<IElement> value)
     {
-        elements.clear();
+        if (size_ == capacity_)
+            reserve(size_type(capacity_) * 2);
+
+        new (data_ + size_) value_type(key, std::move(value));
+        ++size_;
     }
 
-    bool InfoElements::empty() const noexcept
+    void InfoElements::erase(iterator it)
     {
-        return elements.empty();
+        assert(it >= begin() && it < end());
+
+        std::move(it + 1, end(), it);
+        data_[--size_].~value_type();
     }
 
-    InfoElements::Container::size_type InfoElements::size() const noexcept
+    void InfoElements::clear() noexcept
     {
-        return elements.size();
+        while (size_ > 0)
+            data_[--size_].~value_type();
     }
 
-    InfoElements::InfoElements(const InfoElements& other) : elements()
+    InfoElements::InfoElements(const InfoElements& other) : InfoElements()
     {
-        elements.reserve(other.size());
-        std::transform(other.begin(), other.end(), std::back_inserter(elements), [](const auto& el) {
-            assert(el.second);
-            return std::make_pair(el.first, refract::clone(*el.second));
-        });
+        clone(other);
     }
 
     void InfoElements::clone(const InfoElements& other)
     {
-        std::transform(other.begin(), other.end(), std::back_inserter(elements), [](const auto& el) {
+        reserve(size() + other.size());
+
+        for (const auto& el : other) {
             assert(el.second);
-            return std::make_pair(el.first, refract::clone(*el.second));
-        });
+            emplace_back(el.first, refract::clone(*el.second));
+        }
     }
 
-    void InfoElements::erase(const std::string& key)
+    void InfoElements::erase(Symbol key)
     {
-        elements.erase(
-            std::remove_if(
-                elements.begin(), elements.end(), [&key](const auto& keyValue) { return keyValue.first == key; }),
-            elements.end());
+        auto last = std::remove_if(begin(), end(), [key](const auto& keyValue) { return keyValue.first == key; });
+
+        while (end() != last)
+            data_[--size_].~value_type();
     }
 
-    IElement& InfoElements::set(const std::string& key, std::unique_ptr<IElement> value)
+    IElement& InfoElements::set(Symbol key, std::unique_ptr<IElement> value)
     {
         auto& valueRef = *value;
 
         auto it = find(key);
         if (it == end())
-            elements.emplace_back(key, std::move(value));
+            emplace_back(key, std::move(value));
         else
             it->second = std::move(value);
 
         return valueRef;
     }
 
-    IElement& InfoElements::set(const std::string& key, const IElement& value)
+    IElement& InfoElements::set(Symbol key, const IElement& value)
     {
         return set(key, refract::clone(value));
     }
 
-    std::unique_ptr<IElement> InfoElements::claim(const std::string& key)
+    std::unique_ptr<IElement> InfoElements::claim(Symbol key)
     {
         auto member = find(key);
-        if (member != elements.end()) {
+        if (member != end()) {
             return claim(member);
         }
         return nullptr;
@@ -124,20 +171,8 @@ namespace refract
     std::unique_ptr<IElement> InfoElements::claim(iterator it)
     {
         std::unique_ptr<IElement> result(it->second.release());
-        elements.erase(it);
+        erase(it);
 
         return result;
     }
-
-    InfoElements::const_iterator InfoElements::find(const std::string& name) const
-    {
-        return std::find_if(
-            elements.begin(), elements.end(), [&name](const auto& keyValue) { return keyValue.first == name; });
-    }
-
-    InfoElements::iterator InfoElements::find(const std::string& name)
-    {
-        return std::find_if(
-            elements.begin(), elements.end(), [&name](const auto& keyValue) { return keyValue.first == name; });
-    }
 }
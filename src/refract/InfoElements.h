@@ -9,69 +9,135 @@
 #ifndef REFRACT_INFO_ELEMENTS_H
 #define REFRACT_INFO_ELEMENTS_H
 
+#include <cstdint>
 #include <memory>
-#include <string>
-#include <vector>
+#include <type_traits>
+#include <utility>
 
 #include "ElementIfc.h"
+#include "Symbol.h"
 
 namespace refract
 {
+    ///
+    /// Meta or attributes of an Element
+    ///
+    /// Ordered map of Symbol keys to Elements. Most elements have no more
+    /// than a few entries, so they are stored inline without allocation
+    /// and looked up by linear search comparing symbol identifiers. The
+    /// storage moves to free store once the inline capacity is exceeded.
+    ///
     class InfoElements final
     {
-        using Container = std::vector<std::pair<std::string, std::unique_ptr<IElement> > >;
-        Container elements;
-
     public:
-        using iterator = typename Container::iterator;
-        using const_iterator = typename Container::const_iterator;
-        using value_type = typename Container::value_type;
+        using value_type = std::pair<Symbol, std::unique_ptr<IElement> >;
+        using iterator = value_type*;
+        using const_iterator = const value_type*;
+        using size_type = std::size_t;
+
+        static constexpr size_type InlineCapacity = 3;
+
+    private:
+        using Storage = typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type;
+
+        value_type* data_;
+        std::uint32_t size_ = 0;
+        std::uint32_t capacity_ = InlineCapacity;
+        Storage inline_[InlineCapacity];
+
+        value_type* inlineData() noexcept
+        {
+            return reinterpret_cast<value_type*>(inline_);
+        }
+
+        bool isInline() const noexcept
+        {
+            return data_ == reinterpret_cast<const value_type*>(inline_);
+        }
+
+        void reserve(size_type capacity);
+        void release() noexcept;
+        void moveFrom(InfoElements& other) noexcept;
+        void emplace_back(Symbol key, std::unique_ptr<IElement> value);
 
     public:
-        InfoElements();
-        ~InfoElements() = default;
+        InfoElements() noexcept;
+        ~InfoElements();
 
         InfoElements(const InfoElements&);
-        InfoElements(InfoElements&&);
+        InfoElements(InfoElements&&) noexcept;
 
         InfoElements& operator=(InfoElements);
 
     public:
-        friend void swap(InfoElements& lhs, InfoElements& rhs)
+        friend void swap(InfoElements& lhs, InfoElements& rhs) noexcept
         {
-            using std::swap;
-            swap(lhs.elements, rhs.elements);
+            InfoElements tmp(std::move(lhs));
+            lhs.release();
+            lhs.moveFrom(rhs);
+            rhs.moveFrom(tmp);
         }
 
     public:
-        const_iterator begin() const noexcept;
+        const_iterator begin() const noexcept
+        {
+            return data_;
+        }
+
+        iterator begin() noexcept
+        {
+            return data_;
+        }
 
-        iterator begin() noexcept;
+        const_iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
 
-        const_iterator end() const noexcept;
+        iterator end() noexcept
+        {
+            return data_ + size_;
+        }
 
-        iterator end() noexcept;
+        const_iterator find(Symbol name) const noexcept
+        {
+            const_iterator it = begin();
+            for (; it != end() && it->first != name; ++it)
+                ;
+            return it;
+        }
 
-        const_iterator find(const std::string& name) const;
-        iterator find(const std::string& name);
+        iterator find(Symbol name) noexcept
+        {
+            iterator it = begin();
+            for (; it != end() && it->first != name; ++it)
+                ;
+            return it;
+        }
 
-        IElement& set(const std::string& key, std::unique_ptr<IElement> value);
-        IElement& set(const std::string& key, const IElement& value);
+        IElement& set(Symbol key, std::unique_ptr<IElement> value);
+        IElement& set(Symbol key, const IElement& value);
 
         /// clone elements from `other` to `this`
         void clone(const InfoElements& other);
 
-        void erase(const std::string& key);
+        void erase(Symbol key);
         void erase(iterator it);
 
-        std::unique_ptr<IElement> claim(const std::string& key);
+        std::unique_ptr<IElement> claim(Symbol key);
         std::unique_ptr<IElement> claim(iterator it);
 
-        void clear();
+        void clear() noexcept;
 
-        bool empty() const noexcept;
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
 
-        Container::size_type size() const noexcept;
+        size_type size() const noexcept
+        {
+            return size_;
+        }
     };
 }
 
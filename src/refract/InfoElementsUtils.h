@@ -10,7 +10,6 @@
 #define REFRACT_INFO_ELEMENTS_UTILS_H
 
 #include "InfoElements.h"
-#include "TypeQueryVisitor.h"
 #include "Element.h"
 
 namespace refract
@@ -51,7 +50,7 @@ namespace refract
         if (ta == ie.end()) {
             ie.set(key, make_element<ValueElementType>(from_primitive("fixed")));
         } else {
-            auto arr = TypeQueryVisitor::as<ValueElementType>(ta->second.get());
+            auto arr = dyn_cast<ValueElementType>(ta->second.get());
 
             // not appropriate type of value
             assert(arr);
@@ -63,14 +62,14 @@ namespace refract
 
             const auto e = arr->get().end();
             if (e == std::find_if(arr->get().begin(), e, [&value](const auto& attr) {
-                    if (const auto& str = TypeQueryVisitor::as<Element<DSDType> >(attr.get())) {
+                    if (const auto& str = dyn_cast<Element<DSDType> >(attr.get())) {
                         if (str->get() == value.get())
                             return true;
                     }
 
                     return false;
                 })) { // there is no value
-                arr->get().insert(arr->get().end(), make_element<Element<DSDType> >(std::move(value)));
+                arr->mutate().push_back(make_element<Element<DSDType> >(std::move(value)));
             }
         }
     }
@@ -15,13 +15,13 @@ namespace refract
     {
         bool checkElement(const IElement* e)
         {
-            std::string type;
+            Symbol type;
 
             if (e) {
                 type = e->element();
             }
 
-            return !isReserved(type.c_str());
+            return !isReserved(type);
         }
 
         template <typename T, typename V = typename T::ValueType, bool IsIterable = dsd::is_iterable<V>::value>
@@ -46,6 +46,15 @@ namespace refract
             }
         };
 
+        template <typename T>
+        struct IsExpandable<T, SourceMapElement::ValueType, false> {
+            bool operator()(const T* e) const
+            {
+
+                return false;
+            }
+        };
+
         template <typename T>
         struct IsExpandable<T, SelectElement::ValueType, true> {
             bool operator()(const T* e) const
@@ -155,6 +164,7 @@ namespace refract
     template void IsExpandableVisitor::operator()<ExtendElement>(const ExtendElement&);
     template void IsExpandableVisitor::operator()<OptionElement>(const OptionElement&);
     template void IsExpandableVisitor::operator()<SelectElement>(const SelectElement&);
+    template void IsExpandableVisitor::operator()<SourceMapElement>(const SourceMapElement&);
 
     bool IsExpandableVisitor::get() const
     {
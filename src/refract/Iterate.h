@@ -144,22 +144,15 @@ namespace refract
         Impl impl;
         Visitor iterator;
         Strategy strategy;
-        IApply* apply;
+        ApplyHolder apply;
 
     public:
         template <typename Functor>
-        explicit Iterate(Functor& functor) : impl(), iterator(impl), strategy(), apply(new ApplyImpl<Functor>(functor))
+        explicit Iterate(Functor& functor) : impl(), iterator(impl), strategy(), apply(functor)
         {
             impl.strategy = &strategy;
             impl.iterator = &iterator;
-            impl.apply = apply;
-        }
-
-        ~Iterate()
-        {
-            if (apply) {
-                delete apply;
-            }
+            impl.apply = apply.get();
         }
 
         void operator()(const IElement& e)
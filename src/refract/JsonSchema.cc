@@ -401,7 +401,7 @@ namespace
         if (options.test(NULLABLE_FLAG))
             anyOf.data.emplace_back(nullSchema());
 
-        auto enumerationsIt = e.attributes().find("enumerations");
+        auto enumerationsIt = e.attributes().find(sym::enumerations);
         if (e.attributes().end() != enumerationsIt) {
 
             const auto enums = get<const ArrayElement>(enumerationsIt->second.get());
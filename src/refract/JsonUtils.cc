@@ -52,7 +52,7 @@ so::Value utils::instantiateEmpty(const BooleanElement& e)
 
 const IElement& utils::resolve(const RefElement& element)
 {
-    const auto& resolvedEntry = element.attributes().find("resolved");
+    const auto& resolvedEntry = element.attributes().find(sym::resolved);
     if (resolvedEntry == element.attributes().end()) {
         LOG(error) << "expected all references to be resolved in backend";
         assert(false);
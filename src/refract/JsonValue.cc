@@ -245,7 +245,7 @@ namespace
                 return std::move(alt.second);
 
             LOG(info) << "no value found for EnumElement; searching in `enumerations`";
-            auto enumerationsIt = element.attributes().find("enumerations");
+            auto enumerationsIt = element.attributes().find(sym::enumerations);
             if (element.attributes().end() != enumerationsIt) {
                 const auto enums = get<const ArrayElement>(enumerationsIt->second.get());
                 assert(enums);
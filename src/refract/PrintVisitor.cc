@@ -8,6 +8,7 @@
 
 #include "PrintVisitor.h"
 
+#include <atomic>
 #include <cassert>
 #include <fstream>
 #include <iostream>
@@ -212,6 +213,19 @@ namespace refract
         printValues(e, "Select");
     }
 
+    void PrintVisitor::operator()(const SourceMapElement& e)
+    {
+        indented() << "- SourceMap";
+
+        if (!e.empty()) {
+            const auto& content = e.get();
+            for (std::size_t i = 0; i < content.rangeCount(); ++i)
+                os << " [" << content.location(i) << ", " << content.length(i) << "]";
+        }
+
+        os << '\n';
+    }
+
     void PrintVisitor::Visit(const IElement& e)
     {
         PrintVisitor ps;
@@ -220,11 +234,12 @@ namespace refract
 
     int log_to_files(const IElement& e, const std::string& name /*= "print"*/)
     {
-        static int i = 0;
-        std::ofstream out(std::to_string(i) + "-" + name + ".log");
+        static std::atomic<int> i{ 0 };
+        const int n = i.fetch_add(1);
+        std::ofstream out(std::to_string(n) + "-" + name + ".log");
         PrintVisitor printer(0, out);
         Visit(printer, e);
-        return i++;
+        return n;
     }
 
 }; // namespace refract
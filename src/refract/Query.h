@@ -23,10 +23,10 @@ namespace refract
 
         class Element
         {
-            const std::string name;
+            const Symbol name;
 
         public:
-            Element(const std::string& name) : name(name) {}
+            Element(Symbol name) : name(name) {}
 
             bool operator()(const IElement& e);
         };
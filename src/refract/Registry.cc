@@ -10,44 +10,62 @@
 
 #include "Element.h"
 #include "Exception.h"
-#include "TypeQueryVisitor.h"
 #include <algorithm>
+#include <vector>
 
 using namespace refract;
 
 const IElement* refract::FindRootAncestor(const std::string& name, const Registry& registry)
 {
-    const IElement* parent = registry.find(name);
-
-    while (parent && !isReserved(parent->element())) {
-        const IElement* next = registry.find(parent->element());
-
-        if (!next || (next == parent)) {
-            return parent;
-        }
-
-        parent = next;
-    }
-
-    return parent;
+    return registry.findRoot(name);
 }
 
 std::string Registry::getElementId(IElement& element)
 {
-    auto it = element.meta().find("id");
+    auto it = element.meta().find(sym::id);
 
     if (it == element.meta().end()) {
         throw LogicError("Element has no ID");
     }
 
-    if (const StringElement* s = TypeQueryVisitor::as<const StringElement>(it->second.get())) {
+    if (const StringElement* s = dyn_cast<const StringElement>(it->second.get())) {
         return s->get();
     }
 
     throw LogicError("Value of element meta 'id' is not StringElement");
 }
 
-const IElement* Registry::find(const std::string& name) const
+const Registry::Type* Registry::parentOf(const Type& type) const
+{
+    if (isReserved(type.element->element())) {
+        return nullptr;
+    }
+
+    const Type* parent = findType(type.element->element());
+
+    if (parent == &type) {
+        return nullptr;
+    }
+
+    return parent;
+}
+
+Registry::Type* Registry::parentOf(Type& type)
+{
+    if (isReserved(type.element->element())) {
+        return nullptr;
+    }
+
+    auto i = registrated.find(type.element->element());
+
+    if (i == registrated.end() || &i->second == &type) {
+        return nullptr;
+    }
+
+    return &i->second;
+}
+
+const Registry::Type* Registry::findType(const std::string& name) const
 {
     auto i = registrated.find(name);
 
@@ -55,14 +73,54 @@ const IElement* Registry::find(const std::string& name) const
         return nullptr;
     }
 
-    return i->second.get();
+    return &i->second;
+}
+
+const IElement* Registry::find(const std::string& name) const
+{
+    const Type* type = findType(name);
+    return type ? type->element.get() : nullptr;
+}
+
+const IElement* Registry::findRoot(const std::string& name) const
+{
+    const Type* type = findType(name);
+
+    if (!type) {
+        return nullptr;
+    }
+
+    if (frozen_) {
+        return type->root->element.get();
+    }
+
+    // an unfrozen registry is not checked for cycles
+    std::size_t depth = 0;
+    while (const Type* parent = parentOf(*type)) {
+        if (++depth == registrated.size()) {
+            throw LogicError("base type '" + name + "' circularly referencing itself");
+        }
+
+        type = parent;
+    }
+
+    return type->element.get();
+}
+
+const Registry::Type* Registry::findParent(const Type& type) const
+{
+    return frozen_ ? type.parent : parentOf(type);
 }
 
 bool Registry::add(std::unique_ptr<IElement> element)
 {
     assert(element);
 
-    auto it = element->meta().find("id");
+    if (frozen_) {
+        throw LogicError("Registry is frozen");
+    }
+
+    auto it = element->meta().find(sym::id);
 
     if (it == element->meta().end()) {
         throw LogicError("Element has no ID");
@@ -79,12 +137,18 @@ bool Registry::add(std::unique_ptr<IElement> element)
         return false;
     }
 
-    registrated[id] = std::move(element);
+    Type& type = registrated[id];
+    type.name = id;
+    type.element = std::move(element);
     return true;
 }
 
 bool Registry::remove(const std::string& name)
 {
+    if (frozen_) {
+        throw LogicError("Registry is frozen");
+    }
+
     auto i = registrated.find(name);
 
     if (i == registrated.end()) {
@@ -98,4 +162,45 @@ bool Registry::remove(const std::string& name)
 void Registry::clearAll(bool releaseElements)
 {
     registrated.clear();
+    frozen_ = false;
+}
+
+void Registry::freeze()
+{
+    if (frozen_) {
+        return;
+    }
+
+    for (auto& entry : registrated) {
+        entry.second.parent = parentOf(entry.second);
+        entry.second.root = nullptr;
+    }
+
+    // walk every inheritance chain only up to the first type with a known
+    // root and assign the root to the whole walked part
+    std::vector<Type*> chain;
+
+    for (auto& entry : registrated) {
+        chain.clear();
+
+        Type* type = &entry.second;
+        while (!type->root && type->parent) {
+            if (chain.size() == registrated.size()) {
+                throw LogicError("base type '" + entry.first + "' circularly referencing itself");
+            }
+
+            chain.push_back(type);
+            type = parentOf(*type);
+        }
+
+        const Type* root = type->root ? type->root : type;
+
+        for (Type* t : chain) {
+            t->root = root;
+        }
+
+        type->root = root;
+    }
+
+    frozen_ = true;
 }
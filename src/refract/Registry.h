@@ -8,27 +8,92 @@
 #ifndef REFRACT_REGISTRY_H
 #define REFRACT_REGISTRY_H
 
-#include <map>
 #include <string>
 #include <memory>
+#include <unordered_map>
 
 #include "ElementIfc.h"
 
 namespace refract
 {
+    ///
+    /// Named types of a document, by their meta id
+    ///
+    /// Filled while named types are registered and frozen afterwards. A
+    /// frozen Registry can not be changed until cleared; it knows the
+    /// registered base type and the root ancestor of every named type, so
+    /// neither FindRootAncestor() nor a walk of an inheritance chain needs
+    /// a lookup.
+    ///
     class Registry
     {
-        typedef std::map<std::string, std::unique_ptr<IElement> > Map;
+    public:
+        struct Type {
+            std::string name;
+            std::unique_ptr<IElement> element;
+
+            const Type* parent = nullptr; // registered base type, set by freeze()
+            const Type* root = nullptr;   // set by freeze()
+        };
+
+    private:
+        typedef std::unordered_map<std::string, Type> Map;
         Map registrated;
+        bool frozen_ = false;
 
         std::string getElementId(IElement& element);
 
+        const Type* parentOf(const Type& type) const;
+        Type* parentOf(Type& type);
+
     public:
         const IElement* find(const std::string& name) const;
 
+        ///
+        /// Registered named type with its base type and root ancestor
+        ///
+        /// Base type and root ancestor are set only if the Registry is
+        /// frozen.
+        ///
+        const Type* findType(const std::string& name) const;
+
+        ///
+        /// Last registered type in the inheritance chain of a named type
+        ///
+        /// @return nullptr if name is not registered
+        /// @throw LogicError on circular inheritance in an unfrozen Registry
+        ///
+        const IElement* findRoot(const std::string& name) const;
+
+        ///
+        /// Registered base type of a named type
+        ///
+        /// @return nullptr if the base type is a basic element or not
+        /// registered
+        ///
+        const Type* findParent(const Type& type) const;
+
         bool add(std::unique_ptr<IElement> element);
         bool remove(const std::string& name);
         void clearAll(bool releaseElements = false);
+
+        ///
+        /// Resolve base types and root ancestors of all named types and
+        /// forbid further changes
+        ///
+        /// @throw LogicError on circular inheritance
+        ///
+        void freeze();
+
+        bool frozen() const noexcept
+        {
+            return frozen_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return registrated.size();
+        }
     };
 
     const IElement* FindRootAncestor(const std::string& name, const Registry& registry);
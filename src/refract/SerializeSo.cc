@@ -8,7 +8,11 @@
 
 #include "SerializeSo.h"
 
+#include <algorithm>
+
 #include "../utils/log/Trivial.h"
+#include "../utils/so/JsonIo.h"
+#include "../utils/so/YamlIo.h"
 #include "Element.h"
 
 using namespace refract;
@@ -18,180 +22,371 @@ using namespace drafter::utils::log;
 
 namespace
 {
-    so::Object serialize(const InfoElements& info, bool renderSourceMaps);
-
-    so::Array serializeContent(const dsd::Object& e, bool renderSourceMaps);
-    so::Array serializeContent(const dsd::Array& e, bool renderSourceMaps);
-    so::Value serializeContent(const dsd::Enum& e, bool renderSourceMaps);
-    so::Null serializeContent(const dsd::Null& e, bool renderSourceMaps);
-    so::String serializeContent(const dsd::String& e, bool renderSourceMaps);
-    so::Number serializeContent(const dsd::Number& e, bool renderSourceMaps);
-    so::Value serializeContent(const dsd::Boolean& e, bool renderSourceMaps);
-    so::Array serializeContent(const dsd::Extend& e, bool renderSourceMaps);
-    so::Array serializeContent(const dsd::Select& e, bool renderSourceMaps);
-    so::Array serializeContent(const dsd::Option& e, bool renderSourceMaps);
-    so::Value serializeContent(const dsd::Holder& e, bool renderSourceMaps);
-    so::Object serializeContent(const dsd::Member& e, bool renderSourceMaps);
-    so::String serializeContent(const dsd::Ref& e, bool renderSourceMaps);
-
-    so::Object serializeAny(const IElement& e, bool renderSourceMaps)
-    {
-        so::Object result;
+    template <typename Writer>
+    void serialize(const InfoElements& info, bool renderSourceMaps, Writer& out);
+
+    template <typename Writer>
+    void serializeContent(const dsd::Object& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::Array& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::Enum& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::Null& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::String& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::Number& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::Boolean& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::Extend& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::Select& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::Option& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::Holder& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::Member& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::Ref& e, bool renderSourceMaps, Writer& out);
+    template <typename Writer>
+    void serializeContent(const dsd::SourceMap& e, bool renderSourceMaps, Writer& out);
+
+    bool isRendered(const InfoElements::value_type& entry, bool renderSourceMaps)
+    {
+        return renderSourceMaps || entry.first != "sourceMap";
+    }
+
+    bool hasRendered(const InfoElements& info, bool renderSourceMaps)
+    {
+        return std::any_of(info.begin(), info.end(), [renderSourceMaps](const auto& entry) {
+            return isRendered(entry, renderSourceMaps);
+        });
+    }
+
+    template <typename Writer>
+    void serializeAny(const IElement& e, bool renderSourceMaps, Writer& out)
+    {
+        out.begin_object();
 
         LOG(debug) << "Serializing element `" << e.element() << "`";
-        result.data.emplace_back("element", so::String{ e.element() });
+        out.key("element");
+        out.string(e.element());
 
         {
             LOG(debug) << "Serializing meta of absolute length " << e.meta().size();
-            auto meta = serialize(e.meta(), renderSourceMaps);
-            if (!meta.data.empty())
-                result.data.emplace_back("meta", std::move(meta));
+            if (hasRendered(e.meta(), renderSourceMaps)) {
+                out.key("meta");
+                serialize(e.meta(), renderSourceMaps, out);
+            }
 
             LOG(debug) << "Serializing meta of absolute length " << e.meta().size() << " [DONE]";
         }
 
         {
             LOG(debug) << "Serializing attribute of absolute length " << e.attributes().size();
-            auto attr = serialize(e.attributes(), renderSourceMaps || e.element() == "annotation");
-            if (!attr.data.empty())
-                result.data.emplace_back("attributes", std::move(attr));
+            const bool renderAttributeSourceMaps = renderSourceMaps || e.element() == sym::annotation;
+            if (hasRendered(e.attributes(), renderAttributeSourceMaps)) {
+                out.key("attributes");
+                serialize(e.attributes(), renderAttributeSourceMaps, out);
+            }
 
             LOG(debug) << "Serializing attribute of absolute length " << e.attributes().size() << " [DONE]";
         }
 
         if (!e.empty()) {
-            result.data.emplace_back("content", visit(e, [renderSourceMaps](const auto& el) { //
-                return serializeContent(el.get(), renderSourceMaps);
-            }));
+            out.key("content");
+            visit(e, [renderSourceMaps, &out](const auto& el) { //
+                serializeContent(el.get(), renderSourceMaps, out);
+            });
         }
 
-        return result;
+        out.end_object();
     }
 } // namespace
 
 namespace
 {
-    so::Object serialize(const InfoElements& info, bool renderSourceMaps)
+    template <typename Writer>
+    void serialize(const InfoElements& info, bool renderSourceMaps, Writer& out)
     {
-        so::Object result;
+        out.begin_object();
         for (const auto& entry : info) {
             assert(entry.second);
-            if (renderSourceMaps || entry.first != "sourceMap")
-                result.data.emplace_back(entry.first, serializeAny(*entry.second, renderSourceMaps));
+            if (isRendered(entry, renderSourceMaps)) {
+                out.key(entry.first);
+                serializeAny(*entry.second, renderSourceMaps, out);
+            }
         }
-        return result;
+        out.end_object();
     }
 
-    template <typename ValueT>
-    so::Array serializeListContent(const ValueT& e, bool renderSourceMaps)
+    template <typename ValueT, typename Writer>
+    void serializeListContent(const ValueT& e, bool renderSourceMaps, Writer& out)
     {
-        so::Array result;
+        out.begin_array();
 
         for (const auto& entry : e) {
             assert(entry);
-            result.data.emplace_back(serializeAny(*entry, renderSourceMaps));
+            serializeAny(*entry, renderSourceMaps, out);
         }
 
-        return result;
+        out.end_array();
     }
 
 } // namespace
 
 namespace
 {
-    so::Array serializeContent(const dsd::Object& value, bool renderSourceMaps)
+    template <typename Writer>
+    void serializeContent(const dsd::Object& value, bool renderSourceMaps, Writer& out)
     {
         LOG(debug) << "Serializing ObjectElement content";
-        return serializeListContent(value, renderSourceMaps);
+        serializeListContent(value, renderSourceMaps, out);
     }
 
-    so::Array serializeContent(const dsd::Array& value, bool renderSourceMaps)
+    template <typename Writer>
+    void serializeContent(const dsd::Array& value, bool renderSourceMaps, Writer& out)
     {
         LOG(debug) << "Serializing ArrayElement content";
-        return serializeListContent(value, renderSourceMaps);
+        serializeListContent(value, renderSourceMaps, out);
     }
 
-    so::Value serializeContent(const dsd::Enum& value, bool renderSourceMaps)
+    template <typename Writer>
+    void serializeContent(const dsd::Enum& value, bool renderSourceMaps, Writer& out)
     {
         LOG(debug) << "Serializing EnumElement content";
         assert(value.value());
-        return serializeAny(*value.value(), renderSourceMaps);
+        serializeAny(*value.value(), renderSourceMaps, out);
     }
 
-    so::Null serializeContent(const dsd::Null& value, bool)
+    template <typename Writer>
+    void serializeContent(const dsd::Null& value, bool, Writer& out)
     {
         LOG(debug) << "Serializing NullElement content";
-        return so::Null{};
+        out.null();
     }
 
-    so::String serializeContent(const dsd::String& value, bool)
+    template <typename Writer>
+    void serializeContent(const dsd::String& value, bool, Writer& out)
     {
         LOG(debug) << "Serializing StringElement content";
-        return so::String{ value.get() };
+        out.string(value.get());
     }
 
-    so::Number serializeContent(const dsd::Number& value, bool)
+    template <typename Writer>
+    void serializeContent(const dsd::Number& value, bool, Writer& out)
     {
         LOG(debug) << "Serializing NumberElement content";
-        return so::Number{ value.get() };
+        out.number(value.get());
     }
 
-    so::Value serializeContent(const dsd::Boolean& value, bool)
+    template <typename Writer>
+    void serializeContent(const dsd::Boolean& value, bool, Writer& out)
     {
         LOG(debug) << "Serializing BooleanElement content";
-        if (value.get())
-            return so::True{};
-        return so::False{};
+        out.boolean(value.get());
     }
 
-    so::Array serializeContent(const dsd::Extend& value, bool renderSourceMaps)
+    template <typename Writer>
+    void serializeContent(const dsd::Extend& value, bool renderSourceMaps, Writer& out)
     {
         LOG(debug) << "Serializing ExtendElement content";
-        return serializeListContent(value, renderSourceMaps);
+        serializeListContent(value, renderSourceMaps, out);
     }
 
-    so::Array serializeContent(const dsd::Select& value, bool renderSourceMaps)
+    template <typename Writer>
+    void serializeContent(const dsd::Select& value, bool renderSourceMaps, Writer& out)
     {
         LOG(debug) << "Serializing SelectElement content";
-        return serializeListContent(value, renderSourceMaps);
+        serializeListContent(value, renderSourceMaps, out);
     }
 
-    so::Array serializeContent(const dsd::Option& value, bool renderSourceMaps)
+    template <typename Writer>
+    void serializeContent(const dsd::Option& value, bool renderSourceMaps, Writer& out)
     {
         LOG(debug) << "Serializing OptionElement content";
-        return serializeListContent(value, renderSourceMaps);
+        serializeListContent(value, renderSourceMaps, out);
     }
 
-    so::Value serializeContent(const dsd::Holder& value, bool renderSourceMaps)
+    template <typename Writer>
+    void serializeContent(const dsd::Holder& value, bool renderSourceMaps, Writer& out)
     {
         LOG(debug) << "Serializing HolderElement content";
         assert(value.data());
-        return serializeAny(*value.data(), renderSourceMaps);
+        serializeAny(*value.data(), renderSourceMaps, out);
     }
 
-    so::Object serializeContent(const dsd::Member& value, bool renderSourceMaps)
+    template <typename Writer>
+    void serializeContent(const dsd::Member& value, bool renderSourceMaps, Writer& out)
     {
         LOG(debug) << "Serializing MemberElement content";
-        so::Object result;
+        out.begin_object();
 
         assert(value.key());
-        result.data.emplace_back("key", serializeAny(*value.key(), renderSourceMaps));
+        out.key("key");
+        serializeAny(*value.key(), renderSourceMaps, out);
 
-        if (const auto v = value.value())
-            result.data.emplace_back("value", serializeAny(*v, renderSourceMaps));
-        return result;
+        if (const auto v = value.value()) {
+            out.key("value");
+            serializeAny(*v, renderSourceMaps, out);
+        }
+
+        out.end_object();
     }
 
-    so::String serializeContent(const dsd::Ref& value, bool)
+    template <typename Writer>
+    void serializeContent(const dsd::Ref& value, bool, Writer& out)
     {
         LOG(debug) << "Serializing RefElement content";
-        return so::String{ value.symbol() };
+        out.string(value.symbol());
+    }
+
+    // NumberElement as serialized by serializeAny
+    template <typename Writer>
+    void serializeNumber(dsd::SourceMap::Position value, Writer& out)
+    {
+        out.begin_object();
+        out.key("element");
+        out.string(sym::number);
+        out.key("content");
+        out.number(std::to_string(value));
+        out.end_object();
     }
 
+    template <typename Writer>
+    void serializeContent(const dsd::SourceMap& value, bool, Writer& out)
+    {
+        LOG(debug) << "Serializing SourceMapElement content";
+        out.begin_array();
+
+        for (std::size_t i = 0; i < value.rangeCount(); ++i) {
+            out.begin_object();
+            out.key("element");
+            out.string(sym::array);
+            out.key("content");
+            out.begin_array();
+            serializeNumber(value.location(i), out);
+            serializeNumber(value.length(i), out);
+            out.end_array();
+            out.end_object();
+        }
+
+        out.end_array();
+    }
+
+} // namespace
+
+namespace
+{
+    /// Simple Object built of the value described to it, see so::json_writer
+    class so_builder final
+    {
+        struct container {
+            so::Value value;
+            std::string key;
+        };
+
+        std::vector<container> open_;
+        so::Value result_;
+
+        void add(so::Value&& value)
+        {
+            if (open_.empty())
+                result_ = std::move(value);
+            else if (auto object = get_if<so::Object>(open_.back().value))
+                object->data.emplace_back(std::move(open_.back().key), std::move(value));
+            else
+                get<so::Array>(open_.back().value).data.emplace_back(std::move(value));
+        }
+
+        void end()
+        {
+            assert(!open_.empty());
+            so::Value value = std::move(open_.back().value);
+            open_.pop_back();
+            add(std::move(value));
+        }
+
+    public:
+        void begin_object()
+        {
+            open_.push_back({ so::Object{}, {} });
+        }
+
+        void end_object()
+        {
+            end();
+        }
+
+        void begin_array()
+        {
+            open_.push_back({ so::Array{}, {} });
+        }
+
+        void end_array()
+        {
+            end();
+        }
+
+        void key(const std::string& key)
+        {
+            assert(!open_.empty());
+            open_.back().key = key;
+        }
+
+        void null()
+        {
+            add(so::Null{});
+        }
+
+        void boolean(bool value)
+        {
+            if (value)
+                add(so::True{});
+            else
+                add(so::False{});
+        }
+
+        void string(const std::string& value)
+        {
+            add(so::String{ value });
+        }
+
+        void number(const std::string& value)
+        {
+            add(so::Number{ value });
+        }
+
+        so::Value& result() noexcept
+        {
+            return result_;
+        }
+    };
 } // namespace
 
 so::Value serialize::renderSo(const IElement& el, bool sourceMaps)
 {
     LOG(info) << "Starting API Elements -> SO serialization";
-    return serializeAny(el, sourceMaps);
+    so_builder builder;
+    serializeAny(el, sourceMaps, builder);
+    return std::move(builder.result());
+}
+
+std::ostream& serialize::renderJson(std::ostream& out, const IElement& el, bool sourceMaps)
+{
+    LOG(info) << "Starting API Elements -> JSON serialization";
+    so::json_writer writer(out);
+    serializeAny(el, sourceMaps, writer);
+    return out;
+}
+
+std::ostream& serialize::renderYaml(std::ostream& out, const IElement& el, bool sourceMaps)
+{
+    LOG(info) << "Starting API Elements -> YAML serialization";
+    so::yaml_writer writer(out);
+    serializeAny(el, sourceMaps, writer);
+    return out;
 }
@@ -9,6 +9,8 @@
 #ifndef REFRACT_SERIALIZE_H
 #define REFRACT_SERIALIZE_H
 
+#include <iosfwd>
+
 #include "../utils/so/Value.h"
 #include "ElementIfc.h"
 
@@ -28,6 +30,34 @@ namespace refract
         ///
         drafter::utils::so::Value renderSo(const IElement& el, bool sourceMaps);
 
+        ///
+        /// Write an API Element tree as JSON while walking it, without
+        /// building its Simple Object first
+        /// @note   output equals serialize_json() of renderSo()
+        ///
+        /// @param out          stream written to
+        /// @param el           API Element to be written
+        /// @param sourceMaps   whether to print source maps; source maps on
+        ///                     Annotation Elements are always rendered
+        ///
+        /// @return             given stream
+        ///
+        std::ostream& renderJson(std::ostream& out, const IElement& el, bool sourceMaps);
+
+        ///
+        /// Write an API Element tree as YAML while walking it, without
+        /// building its Simple Object first
+        /// @note   output equals serialize_yaml() of renderSo()
+        ///
+        /// @param out          stream written to
+        /// @param el           API Element to be written
+        /// @param sourceMaps   whether to print source maps; source maps on
+        ///                     Annotation Elements are always rendered
+        ///
+        /// @return             given stream
+        ///
+        std::ostream& renderYaml(std::ostream& out, const IElement& el, bool sourceMaps);
+
     } // namespace serialize
 } // namespace refract
 
@@ -0,0 +1,254 @@
+//
+//  refract/Symbol.cc
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#include "Symbol.h"
+
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+
+using namespace refract;
+
+namespace refract
+{
+    namespace sym
+    {
+#define REFRACT_SYMBOL_CONSTANT(identifier, text) const Symbol identifier(ids::identifier);
+        REFRACT_RESERVED_SYMBOLS(REFRACT_SYMBOL_CONSTANT)
+        REFRACT_WELL_KNOWN_SYMBOLS(REFRACT_SYMBOL_CONSTANT)
+#undef REFRACT_SYMBOL_CONSTANT
+    }
+
+    namespace detail
+    {
+        struct SymbolText {
+            mutable std::atomic<std::size_t> references; // unused if interned
+            const std::size_t hash;
+            const std::string text;
+            const SymbolTable* table; // nullptr if reference counted
+
+            SymbolText(std::size_t references, std::size_t hash, std::string text, const SymbolTable* table)
+                : references(references), hash(hash), text(std::move(text)), table(table)
+            {
+            }
+        };
+    }
+
+    struct SymbolTable::Names {
+        std::mutex mutex;
+        std::deque<detail::SymbolText> texts;
+        std::unordered_multimap<std::size_t, const detail::SymbolText*> byHash;
+    };
+}
+
+namespace
+{
+#define REFRACT_SYMBOL_TEXT(identifier, text) text,
+    const char* const WellKnown[] = {
+        "", //
+        REFRACT_RESERVED_SYMBOLS(REFRACT_SYMBOL_TEXT) //
+        REFRACT_WELL_KNOWN_SYMBOLS(REFRACT_SYMBOL_TEXT) //
+    };
+#undef REFRACT_SYMBOL_TEXT
+
+    static_assert(sizeof(WellKnown) / sizeof(WellKnown[0]) == sym::ids::count_, "well known symbols out of sync");
+
+    std::size_t hashOf(const char* s, std::size_t length) noexcept
+    {
+        // FNV-1a
+        std::size_t hash = 2166136261u;
+
+        for (std::size_t i = 0; i < length; ++i) {
+            hash ^= static_cast<unsigned char>(s[i]);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    ///
+    /// Strings of well known Symbols and an open addressing index of them,
+    /// never changed after construction, so it is read without locking
+    ///
+    class WellKnownTable
+    {
+        static constexpr std::size_t Slots = 256; // at least twice the number of well known symbols
+
+        static_assert(Slots >= 2 * sym::ids::count_, "too many well known symbols");
+
+        std::string strings_[sym::ids::count_];
+        std::uint16_t slots_[Slots] = {}; // id + 1, 0 if empty
+
+    public:
+        WellKnownTable()
+        {
+            for (std::uint32_t id = 0; id < sym::ids::count_; ++id) {
+                strings_[id] = WellKnown[id];
+
+                std::size_t slot = hashOf(strings_[id].data(), strings_[id].size()) % Slots;
+                while (slots_[slot])
+                    slot = (slot + 1) % Slots;
+
+                slots_[slot] = static_cast<std::uint16_t>(id + 1);
+            }
+        }
+
+        const std::string& str(std::uint32_t id) const noexcept
+        {
+            return strings_[id];
+        }
+
+        /// @return NotWellKnown if s is not well known
+        std::uint32_t find(const char* s, std::size_t length, std::size_t hash) const noexcept
+        {
+            for (std::size_t slot = hash % Slots; slots_[slot]; slot = (slot + 1) % Slots) {
+                const std::string& candidate = strings_[slots_[slot] - 1];
+
+                if (candidate.size() == length && std::memcmp(candidate.data(), s, length) == 0)
+                    return slots_[slot] - 1;
+            }
+
+            return Symbol::NotWellKnown;
+        }
+    };
+
+    const WellKnownTable& wellKnownTable()
+    {
+        // never destroyed, symbols can be used by destructors of other statics
+        static const WellKnownTable* instance = new WellKnownTable;
+        return *instance;
+    }
+}
+
+namespace
+{
+    thread_local SymbolTable* currentTable = nullptr;
+}
+
+SymbolTable::SymbolTable() : names_(std::make_unique<Names>()) {}
+
+SymbolTable::~SymbolTable() = default;
+
+std::size_t SymbolTable::size() const
+{
+    std::lock_guard<std::mutex> lock(names_->mutex);
+    return names_->texts.size();
+}
+
+SymbolScope::SymbolScope(SymbolTable& table) noexcept : previous_(currentTable)
+{
+    currentTable = &table;
+}
+
+SymbolScope::~SymbolScope()
+{
+    currentTable = previous_;
+}
+
+constexpr std::uint32_t Symbol::NotWellKnown;
+
+std::uintptr_t Symbol::make(const char* s, std::size_t length)
+{
+    const std::size_t hash = hashOf(s, length);
+    const std::uint32_t id = wellKnownTable().find(s, length, hash);
+
+    if (id != NotWellKnown)
+        return (static_cast<std::uintptr_t>(id) << 1) | 1;
+
+    if (!currentTable)
+        return reinterpret_cast<std::uintptr_t>(new detail::SymbolText(1, hash, std::string(s, length), nullptr));
+
+    auto& names = *currentTable->names_;
+    std::lock_guard<std::mutex> lock(names.mutex);
+
+    auto range = names.byHash.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+        if (it->second->text.size() == length && std::memcmp(it->second->text.data(), s, length) == 0)
+            return reinterpret_cast<std::uintptr_t>(it->second) | 2;
+
+    names.texts.emplace_back(0, hash, std::string(s, length), currentTable);
+    names.byHash.emplace(hash, &names.texts.back());
+
+    return reinterpret_cast<std::uintptr_t>(&names.texts.back()) | 2;
+}
+
+Symbol::Symbol(const char* s) : value_(make(s, std::strlen(s))) {}
+
+Symbol Symbol::find(const char* s, std::size_t length) noexcept
+{
+    const std::uint32_t id = wellKnownTable().find(s, length, hashOf(s, length));
+    return id != NotWellKnown ? Symbol(static_cast<sym::ids::Id>(id)) : Symbol();
+}
+
+const detail::SymbolText& Symbol::text() const noexcept
+{
+    return *reinterpret_cast<const detail::SymbolText*>(value_ & ~std::uintptr_t{ 3 });
+}
+
+void Symbol::acquire() const noexcept
+{
+    text().references.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Symbol::release() noexcept
+{
+    auto text = reinterpret_cast<detail::SymbolText*>(value_);
+
+    if (text->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete text;
+}
+
+const std::string& Symbol::str() const noexcept
+{
+    return wellKnown() ? wellKnownTable().str(id()) : text().text;
+}
+
+std::size_t Symbol::hash() const noexcept
+{
+    return wellKnown() ? value_ : text().hash;
+}
+
+bool refract::operator==(const Symbol& lhs, const Symbol& rhs) noexcept
+{
+    if (lhs.value_ == rhs.value_)
+        return true;
+
+    // a well known name is never a reference counted nor interned one
+    if (lhs.wellKnown() || rhs.wellKnown())
+        return false;
+
+    // a table interns each name once
+    if (lhs.text().table && lhs.text().table == rhs.text().table)
+        return false;
+
+    return lhs.text().hash == rhs.text().hash && lhs.text().text == rhs.text().text;
+}
+
+bool refract::operator<(const Symbol& lhs, const Symbol& rhs) noexcept
+{
+    if (lhs.wellKnown() || rhs.wellKnown())
+        return lhs.id() < rhs.id();
+
+    return lhs.text().text < rhs.text().text;
+}
+
+bool refract::operator==(const Symbol& lhs, const std::string& rhs) noexcept
+{
+    return lhs.str() == rhs;
+}
+
+bool refract::operator==(const Symbol& lhs, const char* rhs) noexcept
+{
+    return lhs.str() == rhs;
+}
+
+std::ostream& refract::operator<<(std::ostream& out, const Symbol& symbol)
+{
+    return out << symbol.str();
+}
@@ -0,0 +1,393 @@
+//
+//  refract/Symbol.h
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#ifndef REFRACT_SYMBOL_H
+#define REFRACT_SYMBOL_H
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <utility>
+
+///
+/// Names of Refract Elements reserved by Refract itself
+///
+#define REFRACT_RESERVED_SYMBOLS(X)                                                                                    \
+    X(array, "array")                                                                                                  \
+    X(boolean, "boolean")                                                                                              \
+    X(enum_, "enum")                                                                                                   \
+    X(extend, "extend")                                                                                                \
+    X(generic, "generic")                                                                                              \
+    X(member, "member")                                                                                                \
+    X(null, "null")                                                                                                    \
+    X(number, "number")                                                                                                \
+    X(object, "object")                                                                                                \
+    X(option, "option")                                                                                                \
+    X(ref, "ref")                                                                                                      \
+    X(select, "select")                                                                                                \
+    X(string, "string")
+
+///
+/// Element names, meta and attribute keys of API Elements
+///
+#define REFRACT_WELL_KNOWN_SYMBOLS(X)                                                                                  \
+    X(metadata, "metadata")                                                                                            \
+    X(reference, "reference")                                                                                          \
+    X(id, "id")                                                                                                        \
+    X(name, "name")                                                                                                    \
+    X(description, "description")                                                                                      \
+    X(dataStructure, "dataStructure")                                                                                  \
+    X(dataStructures, "dataStructures")                                                                                \
+    X(resourceGroup, "resourceGroup")                                                                                  \
+    X(resourceGroups, "resourceGroups")                                                                                \
+    X(resource, "resource")                                                                                            \
+    X(resources, "resources")                                                                                          \
+    X(uri, "uri")                                                                                                      \
+    X(uriTemplate, "uriTemplate")                                                                                      \
+    X(assets, "assets")                                                                                                \
+    X(actions, "actions")                                                                                              \
+    X(action, "action")                                                                                                \
+    X(relation, "relation")                                                                                            \
+    X(attributes, "attributes")                                                                                        \
+    X(method, "method")                                                                                                \
+    X(examples, "examples")                                                                                            \
+    X(requests, "requests")                                                                                            \
+    X(responses, "responses")                                                                                          \
+    X(body, "body")                                                                                                    \
+    X(schema, "schema")                                                                                                \
+    X(headers, "headers")                                                                                              \
+    X(model, "model")                                                                                                  \
+    X(value, "value")                                                                                                  \
+    X(parameters, "parameters")                                                                                        \
+    X(type, "type")                                                                                                    \
+    X(required, "required")                                                                                            \
+    X(default_, "default")                                                                                             \
+    X(enumerations, "enumerations")                                                                                    \
+    X(nullable, "nullable")                                                                                            \
+    X(example, "example")                                                                                              \
+    X(values, "values")                                                                                                \
+    X(source, "source")                                                                                                \
+    X(resolved, "resolved")                                                                                            \
+    X(element, "element")                                                                                              \
+    X(role, "role")                                                                                                    \
+    X(version_, "_version")                                                                                            \
+    X(ast, "ast")                                                                                                      \
+    X(sourcemap, "sourcemap")                                                                                          \
+    X(error, "error")                                                                                                  \
+    X(warning, "warning")                                                                                              \
+    X(warnings, "warnings")                                                                                            \
+    X(code, "code")                                                                                                    \
+    X(message, "message")                                                                                              \
+    X(location, "location")                                                                                            \
+    X(index, "index")                                                                                                  \
+    X(length, "length")                                                                                                \
+    X(line, "line")                                                                                                    \
+    X(column, "column")                                                                                                \
+    X(variable, "variable")                                                                                            \
+    X(content, "content")                                                                                              \
+    X(meta, "meta")                                                                                                    \
+    X(title, "title")                                                                                                  \
+    X(classes, "classes")                                                                                              \
+    X(samples, "samples")                                                                                              \
+    X(typeAttributes, "typeAttributes")                                                                                \
+    X(optional, "optional")                                                                                            \
+    X(fixed, "fixed")                                                                                                  \
+    X(fixedType, "fixedType")                                                                                          \
+    X(true_, "true")                                                                                                   \
+    X(href, "href")                                                                                                    \
+    X(path, "path")                                                                                                    \
+    X(category, "category")                                                                                            \
+    X(copy, "copy")                                                                                                    \
+    X(api, "api")                                                                                                      \
+    X(user, "user")                                                                                                    \
+    X(transition, "transition")                                                                                        \
+    X(hrefVariables, "hrefVariables")                                                                                  \
+    X(httpHeaders, "httpHeaders")                                                                                      \
+    X(httpTransaction, "httpTransaction")                                                                              \
+    X(contentType, "contentType")                                                                                      \
+    X(httpResponse, "httpResponse")                                                                                    \
+    X(httpRequest, "httpRequest")                                                                                      \
+    X(statusCode, "statusCode")                                                                                        \
+    X(asset, "asset")                                                                                                  \
+    X(messageBody, "messageBody")                                                                                      \
+    X(messageBodySchema, "messageBodySchema")                                                                          \
+    X(data, "data")                                                                                                    \
+    X(parseResult, "parseResult")                                                                                      \
+    X(annotation, "annotation")                                                                                        \
+    X(sourceMap, "sourceMap")
+
+namespace refract
+{
+    namespace sym
+    {
+        namespace ids
+        {
+#define REFRACT_SYMBOL_ID(identifier, text) identifier,
+            enum Id : std::uint32_t
+            {
+                empty_ = 0,
+                REFRACT_RESERVED_SYMBOLS(REFRACT_SYMBOL_ID) //
+                REFRACT_WELL_KNOWN_SYMBOLS(REFRACT_SYMBOL_ID) //
+                count_
+            };
+#undef REFRACT_SYMBOL_ID
+        }
+    }
+
+    namespace detail
+    {
+        struct SymbolText;
+    }
+
+    ///
+    /// Names of a single document, interned by Symbols created while a
+    /// SymbolScope of the table is active
+    ///
+    /// Names are released together with the table, it has to outlive every
+    /// Symbol interned in it. Safe to use from several threads.
+    ///
+    class SymbolTable final
+    {
+        struct Names;
+        std::unique_ptr<Names> names_;
+
+        friend class Symbol;
+
+    public:
+        SymbolTable();
+        ~SymbolTable();
+
+        SymbolTable(const SymbolTable&) = delete;
+        SymbolTable& operator=(const SymbolTable&) = delete;
+
+        ///
+        /// Number of names interned so far
+        ///
+        std::size_t size() const;
+    };
+
+    ///
+    /// Intern names of Symbols created by this thread in a SymbolTable
+    /// until the scope ends; scopes nest
+    ///
+    class SymbolScope final
+    {
+        SymbolTable* previous_;
+
+    public:
+        explicit SymbolScope(SymbolTable& table) noexcept;
+        ~SymbolScope();
+
+        SymbolScope(const SymbolScope&) = delete;
+        SymbolScope& operator=(const SymbolScope&) = delete;
+    };
+
+    ///
+    /// Name of an Element, meta or attribute key
+    ///
+    /// Names listed in REFRACT_RESERVED_SYMBOLS and REFRACT_WELL_KNOWN_SYMBOLS
+    /// are constants in namespace `sym`. Creating a Symbol of such a name
+    /// neither locks nor allocates, copies are free and comparison compares
+    /// integers.
+    ///
+    /// Other names, e.g. named types of a document, are interned in the
+    /// SymbolTable of the current SymbolScope. Copies of them are free as
+    /// well, and Symbols of one table are compared by their identity. Out of
+    /// any scope, such names are reference counted strings owned by the
+    /// Symbols referring to them, released with the last of them.
+    ///
+    class Symbol
+    {
+        // (id << 1) | 1 if well known, detail::SymbolText* | 2 if interned,
+        // reference counted detail::SymbolText* otherwise
+        std::uintptr_t value_ = 1;
+
+        constexpr bool wellKnown() const noexcept
+        {
+            return value_ & 1;
+        }
+
+        constexpr bool counted() const noexcept
+        {
+            return !(value_ & 3);
+        }
+
+        const detail::SymbolText& text() const noexcept;
+
+        void acquire() const noexcept;
+        void release() noexcept;
+
+        static std::uintptr_t make(const char* s, std::size_t length);
+
+        friend bool operator==(const Symbol& lhs, const Symbol& rhs) noexcept;
+        friend bool operator<(const Symbol& lhs, const Symbol& rhs) noexcept;
+
+    public:
+        static constexpr std::uint32_t NotWellKnown = sym::ids::count_;
+
+        ///
+        /// Symbol of an empty string
+        ///
+        constexpr Symbol() noexcept = default;
+
+        ///
+        /// Well known Symbol, see namespace `sym`
+        ///
+        constexpr explicit Symbol(sym::ids::Id id) noexcept : value_((static_cast<std::uintptr_t>(id) << 1) | 1) {}
+
+        ///
+        /// Symbol of a string, allocates unless the name is well known or
+        /// already interned in the table of current SymbolScope
+        ///
+        Symbol(const std::string& s) : value_(make(s.data(), s.size())) {}
+        Symbol(const char* s);
+        Symbol(const char* s, std::size_t length) : value_(make(s, length)) {}
+
+        Symbol(const Symbol& other) noexcept : value_(other.value_)
+        {
+            if (counted())
+                acquire();
+        }
+
+        Symbol(Symbol&& other) noexcept : value_(other.value_)
+        {
+            other.value_ = 1;
+        }
+
+        Symbol& operator=(Symbol other) noexcept
+        {
+            std::swap(value_, other.value_);
+            return *this;
+        }
+
+        ~Symbol()
+        {
+            if (counted())
+                release();
+        }
+
+        ///
+        /// Well known Symbol of a string, neither locks nor allocates
+        ///
+        /// @return empty Symbol if the string is not well known
+        ///
+        static Symbol find(const char* s, std::size_t length) noexcept;
+
+        static Symbol find(const std::string& s) noexcept
+        {
+            return find(s.data(), s.size());
+        }
+
+        ///
+        /// Identifier of a well known Symbol, NotWellKnown for other ones
+        ///
+        constexpr std::uint32_t id() const noexcept
+        {
+            return wellKnown() ? static_cast<std::uint32_t>(value_ >> 1) : NotWellKnown;
+        }
+
+        ///
+        /// String of the Symbol, valid as long as the Symbol
+        ///
+        const std::string& str() const noexcept;
+
+        operator const std::string&() const noexcept
+        {
+            return str();
+        }
+
+        const char* c_str() const noexcept
+        {
+            return str().c_str();
+        }
+
+        bool empty() const noexcept
+        {
+            return value_ == 1;
+        }
+
+        std::size_t hash() const noexcept;
+    };
+
+    bool operator==(const Symbol& lhs, const Symbol& rhs) noexcept;
+
+    inline bool operator!=(const Symbol& lhs, const Symbol& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /// Well known Symbols in order of declaration, then other ones alphabetically
+    bool operator<(const Symbol& lhs, const Symbol& rhs) noexcept;
+
+    bool operator==(const Symbol& lhs, const std::string& rhs) noexcept;
+    bool operator==(const Symbol& lhs, const char* rhs) noexcept;
+
+    inline bool operator==(const std::string& lhs, const Symbol& rhs) noexcept
+    {
+        return rhs == lhs;
+    }
+
+    inline bool operator==(const char* lhs, const Symbol& rhs) noexcept
+    {
+        return rhs == lhs;
+    }
+
+    inline bool operator!=(const Symbol& lhs, const std::string& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    inline bool operator!=(const Symbol& lhs, const char* rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    inline bool operator!=(const std::string& lhs, const Symbol& rhs) noexcept
+    {
+        return !(rhs == lhs);
+    }
+
+    inline bool operator!=(const char* lhs, const Symbol& rhs) noexcept
+    {
+        return !(rhs == lhs);
+    }
+
+    std::ostream& operator<<(std::ostream& out, const Symbol& symbol);
+
+    ///
+    /// Well known Symbols
+    ///
+    namespace sym
+    {
+#define REFRACT_SYMBOL_CONSTANT(identifier, text) extern const Symbol identifier;
+        REFRACT_RESERVED_SYMBOLS(REFRACT_SYMBOL_CONSTANT)
+        REFRACT_WELL_KNOWN_SYMBOLS(REFRACT_SYMBOL_CONSTANT)
+#undef REFRACT_SYMBOL_CONSTANT
+
+        ///
+        /// Query whether Symbol names an Element reserved by Refract
+        ///
+        inline bool isReserved(const Symbol& s) noexcept
+        {
+            return s.id() >= ids::array && s.id() <= ids::string;
+        }
+    }
+}
+
+namespace std
+{
+    template <>
+    struct hash<refract::Symbol> {
+        size_t operator()(const refract::Symbol& s) const noexcept
+        {
+            return s.hash();
+        }
+    };
+}
+
+#endif // #ifndef REFRACT_SYMBOL_H
@@ -38,6 +38,8 @@ namespace refract
             Option,
             Select,
 
+            SourceMap,
+
             Unknown = 0,
         } ElementType;
 
@@ -61,49 +63,24 @@ namespace refract
         void operator()(const ExtendElement& e);
         void operator()(const OptionElement& e);
         void operator()(const SelectElement& e);
+        void operator()(const SourceMapElement& e);
 
         ElementType get() const;
 
+        ///
+        /// Downcast an Element
+        /// @deprecated use dyn_cast, it does not visit the Element
+        ///
         template <typename E>
         static E* as(IElement* e)
         {
-            if (!e) {
-                return static_cast<E*>(e);
-            }
-
-            TypeQueryVisitor tq;
-            Visit(tq, *e);
-
-            E type;
-            TypeQueryVisitor eq;
-            VisitBy(type, eq);
-
-            if (eq.typeInfo != tq.typeInfo) {
-                return 0;
-            }
-
-            return static_cast<E*>(e);
+            return dyn_cast<E>(e);
         }
 
         template <typename E>
         static const E* as(const IElement* e)
         {
-            if (!e) {
-                return static_cast<const E*>(e);
-            }
-
-            TypeQueryVisitor tq;
-            Visit(tq, *e);
-
-            E type;
-            TypeQueryVisitor eq;
-            VisitBy(type, eq);
-
-            if (eq.typeInfo != tq.typeInfo) {
-                return 0;
-            }
-
-            return static_cast<const E*>(e);
+            return dyn_cast<E>(e);
         }
     };
 
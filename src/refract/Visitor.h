@@ -8,6 +8,9 @@
 #ifndef REFRACT_VISITOR_H
 #define REFRACT_VISITOR_H
 
+#include <new>
+#include <type_traits>
+
 #include "ElementFwd.h"
 #include "ElementIfc.h"
 
@@ -30,6 +33,7 @@ namespace refract
         virtual void visit(const ExtendElement& e) = 0;
         virtual void visit(const OptionElement& e) = 0;
         virtual void visit(const SelectElement& e) = 0;
+        virtual void visit(const SourceMapElement& e) = 0;
 
         virtual ~IApply() {}
     };
@@ -62,32 +66,71 @@ namespace refract
         APPLY_VISIT_IMPL(ExtendElement)
         APPLY_VISIT_IMPL(OptionElement)
         APPLY_VISIT_IMPL(SelectElement)
+        APPLY_VISIT_IMPL(SourceMapElement)
 
         virtual ~ApplyImpl() {}
     };
 
 #undef APPLY_VISIT_IMPL
 
-    class Visitor
+    ///
+    /// Storage for ApplyImpl of any functor type
+    ///
+    /// ApplyImpl holds just a reference to the functor, so its size does
+    /// not depend on the functor type and it is kept in place instead of
+    /// being allocated per visit.
+    ///
+    class ApplyHolder
     {
+        struct AnyFunctor {
+        };
 
-    private:
+        using Storage = std::aligned_storage<sizeof(ApplyImpl<AnyFunctor>), alignof(ApplyImpl<AnyFunctor>)>::type;
+
+        Storage storage;
         IApply* apply;
 
     public:
         template <typename Functor>
-        Visitor(Functor& functor) : apply(new ApplyImpl<Functor>(functor))
+        explicit ApplyHolder(Functor& functor)
         {
+            static_assert(sizeof(ApplyImpl<Functor>) <= sizeof(Storage), "ApplyImpl does not fit ApplyHolder");
+            static_assert(alignof(ApplyImpl<Functor>) <= alignof(Storage), "ApplyImpl does not fit ApplyHolder");
+
+            apply = new (&storage) ApplyImpl<Functor>(functor);
         }
-        virtual ~Visitor()
+
+        ~ApplyHolder()
+        {
+            apply->~IApply();
+        }
+
+        ApplyHolder(const ApplyHolder&) = delete;
+        ApplyHolder& operator=(const ApplyHolder&) = delete;
+
+        IApply* get() noexcept
+        {
+            return apply;
+        }
+    };
+
+    class Visitor
+    {
+
+    private:
+        ApplyHolder apply;
+
+    public:
+        template <typename Functor>
+        Visitor(Functor& functor) : apply(functor)
         {
-            delete apply;
         }
+        virtual ~Visitor() {}
 
         template <typename T>
         void visit(const T& e)
         {
-            apply->visit(e);
+            apply.get()->visit(e);
         }
     };
 
@@ -12,13 +12,13 @@ using namespace refract;
 
 const StringElement* refract::GetDescription(const IElement& e)
 {
-    auto i = e.meta().find("description");
+    auto i = e.meta().find(sym::description);
 
     if (i == e.meta().end()) {
         return nullptr;
     }
 
-    return TypeQueryVisitor::as<const StringElement>(i->second.get());
+    return dyn_cast<const StringElement>(i->second.get());
 }
 
 std::string refract::GetKeyAsString(const MemberElement& e)
@@ -30,14 +30,14 @@ std::string refract::GetKeyAsString(const MemberElement& e)
         return {};
     }
 
-    if (auto str = TypeQueryVisitor::as<const StringElement>(element)) {
+    if (auto str = dyn_cast<const StringElement>(element)) {
         return str->get();
     }
 
-    if (auto ext = TypeQueryVisitor::as<const ExtendElement>(element)) {
+    if (auto ext = dyn_cast<const ExtendElement>(element)) {
         auto merged = ext->get().merge();
 
-        if (auto str = TypeQueryVisitor::as<const StringElement>(merged.get())) {
+        if (auto str = dyn_cast<const StringElement>(merged.get())) {
 
             std::string result{};
 
@@ -73,16 +73,14 @@ MemberElement* refract::FindMemberByKey(const ObjectElement& e, const std::strin
 
 bool refract::IsLiteral(const IElement& e)
 {
-    TypeQueryVisitor query;
-    VisitBy(e, query);
-    auto elementType = query.get();
+    const ElementKind elementType = e.kind();
 
-    if (elementType == TypeQueryVisitor::Null)
+    if (elementType == ElementKind::Null)
         return false;
 
     if (!e.empty()
-        && (elementType == TypeQueryVisitor::String || elementType == TypeQueryVisitor::Number
-               || elementType == TypeQueryVisitor::Boolean)) {
+        && (elementType == ElementKind::String || elementType == ElementKind::Number
+               || elementType == ElementKind::Boolean)) {
         return true;
     }
 
@@ -11,7 +11,6 @@
 #include "Element.h"
 #include "Visitor.h"
 
-#include "TypeQueryVisitor.h"
 #include "ComparableVisitor.h"
 
 // this will be removed, refract should not contain reference to other libraries
@@ -22,20 +21,20 @@ namespace refract
     template <typename T>
     bool HasTypeAttribute(const T& e, std::string typeAttribute)
     {
-        auto ta = e.attributes().find("typeAttributes");
+        auto ta = e.attributes().find(sym::typeAttributes);
 
         if (ta == e.attributes().end()) {
             return false;
         }
 
-        auto attrs = TypeQueryVisitor::as<const ArrayElement>(ta->second.get());
+        auto attrs = dyn_cast<const ArrayElement>(ta->second.get());
 
         if (!attrs) {
             return false;
         }
 
         for (const auto& value : attrs->get()) {
-            auto attr = TypeQueryVisitor::as<const StringElement>(value.get());
+            auto attr = dyn_cast<const StringElement>(value.get());
             if (!attr) {
                 continue;
             }
@@ -50,44 +49,44 @@ namespace refract
     template <typename T>
     bool IsVariableProperty(const T& e)
     {
-        auto const var = e.attributes().find("variable");
+        auto const var = e.attributes().find(sym::variable);
 
         if (var == e.attributes().end()) {
             return false;
         }
 
-        auto b = TypeQueryVisitor::as<const BooleanElement>(var->second.get());
+        auto b = dyn_cast<const BooleanElement>(var->second.get());
         return b ? static_cast<bool>(b->get()) : false;
     }
 
     template <typename T>
     const T* GetDefault(const T& e)
     {
-        auto const dflt = e.attributes().find("default");
+        auto const dflt = e.attributes().find(sym::default_);
 
         if (dflt == e.attributes().end()) {
             return NULL;
         }
 
-        return TypeQueryVisitor::as<const T>(dflt->second.get());
+        return dyn_cast<const T>(dflt->second.get());
     }
 
     template <typename T>
     const T* GetSample(const T& e)
     {
-        auto const i = e.attributes().find("samples");
+        auto const i = e.attributes().find(sym::samples);
 
         if (i == e.attributes().end()) {
             return nullptr;
         }
 
-        auto a = TypeQueryVisitor::as<ArrayElement>(i->second.get());
+        auto a = dyn_cast<ArrayElement>(i->second.get());
 
         if (!a || a->get().empty()) {
             return nullptr;
         }
 
-        return TypeQueryVisitor::as<T>(a->get().begin()->get());
+        return dyn_cast<T>(a->get().begin()->get());
     }
 
     template <typename T, typename R = typename T::ValueType>
@@ -153,7 +152,7 @@ namespace refract
                         }
 
                         // We need to hadle Enum individualy because of attr["enumerations"]
-                        if (const EnumElement* val = TypeQueryVisitor::as<const EnumElement>(item.get())) {
+                        if (const EnumElement* val = dyn_cast<const EnumElement>(item.get())) {
                             auto ret = operator()(*val);
                             if (ret) {
                                 return ret;
@@ -174,13 +173,13 @@ namespace refract
 
         const ArrayElement* GetEnumerations(const EnumElement& e) const
         {
-            auto i = e.attributes().find("enumerations");
+            auto i = e.attributes().find(sym::enumerations);
 
             if (i == e.attributes().end()) {
                 return nullptr;
             }
 
-            return TypeQueryVisitor::as<const ArrayElement>(i->second.get());
+            return dyn_cast<const ArrayElement>(i->second.get());
         }
     };
 
@@ -188,7 +187,7 @@ namespace refract
     template <typename T>
     void CheckMixinParent(const refract::IElement* element)
     {
-        const T* resolved = TypeQueryVisitor::as<T>(element);
+        const T* resolved = dyn_cast<T>(element);
 
         if (!resolved) {
             throw snowcrash::Error(
@@ -202,7 +201,7 @@ namespace refract
     template <typename T, typename Collection, typename Functor>
     void HandleRefWhenFetchingMembers(const refract::IElement& e, Collection& members, const Functor& functor)
     {
-        auto found = e.attributes().find("resolved");
+        auto found = e.attributes().find(sym::resolved);
 
         if (found == e.attributes().end()) {
             return;
@@ -210,7 +209,7 @@ namespace refract
 
         const IElement* foundValue = found->second.get();
 
-        const ExtendElement* extended = TypeQueryVisitor::as<const ExtendElement>(foundValue);
+        const ExtendElement* extended = dyn_cast<const ExtendElement>(foundValue);
 
         if (!extended) {
 
@@ -238,7 +237,7 @@ namespace refract
             return nullptr;
         }
 
-        return TypeQueryVisitor::as<T>(i->second.get());
+        return dyn_cast<T>(i->second.get());
     }
 
     std::string GetKeyAsString(const MemberElement& e);
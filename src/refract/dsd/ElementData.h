@@ -21,8 +21,11 @@
 #include "Option.h"
 #include "Ref.h"
 #include "Select.h"
+#include "SourceMap.h"
 #include "String.h"
 
+#include "../Symbol.h"
+
 namespace refract
 {
     namespace dsd
@@ -67,6 +70,11 @@ namespace refract
         struct data_of<char[N]> {
             using type = dsd::String;
         };
+
+        template <>
+        struct data_of<Symbol> {
+            using type = dsd::String;
+        };
     }
 }
 
@@ -16,7 +16,6 @@
 #include "../Exception.h"
 #include "../Element.h"
 #include "../InfoElements.h"
-#include "../TypeQueryVisitor.h"
 #include "../Utils.h"
 #include "../PrintVisitor.h"
 
@@ -91,22 +90,23 @@ namespace
                 for (const auto& m : merge.get()) {
                     if (value.empty())
                         value.set();
-                    auto valueMatch = [&value, &m]() {
-                        if (auto mergeMember = TypeQueryVisitor::as<const MemberElement>(m.get())) {
+                    auto& content = value.mutate();
+                    auto valueMatch = [&content, &m]() {
+                        if (auto mergeMember = dyn_cast<const MemberElement>(m.get())) {
                             assert(mergeMember);
 
-                            auto mergeKey = TypeQueryVisitor::as<const StringElement>(mergeMember->get().key());
+                            auto mergeKey = dyn_cast<const StringElement>(mergeMember->get().key());
                             assert(mergeKey);
 
-                            return std::find_if(value.get().begin(), value.get().end(), [mergeKey](const auto& e) {
-                                if (auto valueMember = TypeQueryVisitor::as<const MemberElement>(e.get())) {
-                                    auto valueKey = TypeQueryVisitor::as<const StringElement>(valueMember->get().key());
+                            return std::find_if(content.begin(), content.end(), [mergeKey](const auto& e) {
+                                if (auto valueMember = dyn_cast<const MemberElement>(e.get())) {
+                                    auto valueKey = dyn_cast<const StringElement>(valueMember->get().key());
                                     assert(valueKey);
 
                                     return mergeKey->get() == valueKey->get();
                                 }
 
-                                if (auto valueSelect = TypeQueryVisitor::as<const SelectElement>(e.get())) {
+                                if (auto valueSelect = dyn_cast<const SelectElement>(e.get())) {
                                     return valueSelect->get().end()
                                         != std::find_if(valueSelect->get().begin(),
                                                valueSelect->get().end(),
@@ -116,10 +116,10 @@ namespace
                                                               option->get().end(),
                                                               [mergeKey](const auto& optEl) {
                                                                   if (auto optElMember
-                                                                      = TypeQueryVisitor::as<const MemberElement>(
+                                                                      = dyn_cast<const MemberElement>(
                                                                           optEl.get())) {
                                                                       auto optElMemberKey
-                                                                          = TypeQueryVisitor::as<const StringElement>(
+                                                                          = dyn_cast<const StringElement>(
                                                                               optElMember->get().key());
                                                                       assert(optElMemberKey);
                                                                       return optElMemberKey->get() == mergeKey->get();
@@ -131,22 +131,22 @@ namespace
 
                                 return false;
                             });
-                        } else if (auto mergeRef = TypeQueryVisitor::as<const RefElement>(m.get())) {
-                            return std::find_if(value.get().begin(), value.get().end(), [mergeRef](const auto& e) {
-                                if (auto valueRef = TypeQueryVisitor::as<const RefElement>(e.get()))
+                        } else if (auto mergeRef = dyn_cast<const RefElement>(m.get())) {
+                            return std::find_if(content.begin(), content.end(), [mergeRef](const auto& e) {
+                                if (auto valueRef = dyn_cast<const RefElement>(e.get()))
                                     return mergeRef->get() == valueRef->get();
                                 else
                                     return false;
                             });
                         } else {
-                            return value.get().end();
+                            return content.end();
                         }
                     }();
 
-                    if (valueMatch == value.get().end()) {
-                        value.get().push_back(clone(*m));
+                    if (valueMatch == content.end()) {
+                        content.push_back(clone(*m));
                     } else {
-                        value.get().insert(value.get().erase(valueMatch), clone(*m));
+                        content.insert(content.erase(valueMatch), clone(*m));
                     }
                 }
             }
@@ -158,9 +158,10 @@ namespace
 
         void operator()(T& value, const T& merge) const
         {
-            std::transform(merge.get().begin(), merge.get().end(), std::back_inserter(value.get()), [](const auto& e) {
-                return clone(*e);
-            });
+            std::transform(merge.get().begin(),
+                merge.get().end(),
+                std::back_inserter(value.mutate()),
+                [](const auto& e) { return clone(*e); });
         }
     };
 
@@ -168,8 +169,8 @@ namespace
     struct ElementMerge {
         void operator()(IElement& target, const IElement& append) const noexcept
         {
-            assert(TypeQueryVisitor::as<const T>(&target));
-            assert(TypeQueryVisitor::as<const T>(&append));
+            assert(dyn_cast<const T>(&target));
+            assert(dyn_cast<const T>(&append));
 
             InfoMerge<SkipMetaKeywords>{}(target.meta(), append.meta());
             InfoMerge<SkipNothing>{}(target.attributes(), append.attributes());
@@ -199,37 +200,39 @@ namespace
     struct ElementMerge<EnumElement> {
         void operator()(IElement& target, const IElement& append) const noexcept
         {
-            assert(TypeQueryVisitor::as<const EnumElement>(&target));
-            assert(TypeQueryVisitor::as<const EnumElement>(&append));
+            assert(dyn_cast<const EnumElement>(&target));
+            assert(dyn_cast<const EnumElement>(&append));
 
             InfoMerge<SkipMetaKeywords>{}(target.meta(), append.meta());
             InfoMerge<SkipEnumerations>{}(target.attributes(), append.attributes());
 
-            auto target_enums_it = target.attributes().find("enumerations");
-            auto append_enums_it = append.attributes().find("enumerations");
+            auto target_enums_it = target.attributes().find(sym::enumerations);
+            auto append_enums_it = append.attributes().find(sym::enumerations);
 
             if (append_enums_it != append.attributes().end()) {
-                auto append_enums = TypeQueryVisitor::as<const ArrayElement>(append_enums_it->second.get());
+                auto append_enums = dyn_cast<const ArrayElement>(append_enums_it->second.get());
                 assert(append_enums);
 
                 assert(!append_enums->empty());
                 if (!append_enums->get().empty()) {
                     if (target_enums_it == target.attributes().end()) {
-                        target.attributes().set("enumerations", clone(*append_enums));
+                        target.attributes().set(sym::enumerations, clone(*append_enums));
                     } else {
-                        auto target_enums = TypeQueryVisitor::as<ArrayElement>(target_enums_it->second.get());
+                        auto target_enums = dyn_cast<ArrayElement>(target_enums_it->second.get());
                         assert(target_enums);
 
+                        auto& content = target_enums->mutate();
+
                         for (const auto& append_enum : append_enums->get()) {
                             auto it = std::find_if( //
-                                target_enums->get().begin(),
-                                target_enums->get().end(),
+                                content.begin(),
+                                content.end(),
                                 [&append_enum](
                                     auto& target_enum) { return visit(*target_enum, TypeEqual{ *append_enum }); });
-                            if (target_enums->get().end() != it) {
-                                target_enums->get().erase(it);
+                            if (content.end() != it) {
+                                content.erase(it);
                             }
-                            target_enums->get().push_back(clone(*append_enum));
+                            content.push_back(clone(*append_enum));
                         }
                     }
                 }
@@ -243,10 +246,10 @@ namespace
     class ElementMerger
     {
         std::unique_ptr<IElement> result;
-        TypeQueryVisitor::ElementType base;
+        ElementKind base;
 
     public:
-        ElementMerger() : result(nullptr), base(TypeQueryVisitor::Unknown) {}
+        ElementMerger() : result(nullptr), base(ElementKind::Unknown) {}
 
         template <typename E>
         void operator()(const E& e)
@@ -257,52 +260,46 @@ namespace
 
             if (!result) {
                 result = e->clone();
-
-                TypeQueryVisitor type;
-                Visit(type, *result);
-                base = type.get();
+                base = result->kind();
                 return;
             }
 
-            TypeQueryVisitor type;
-            VisitBy(*e, type);
-
-            if (type.get() != base) {
+            if (e->kind() != base) {
                 throw refract::LogicError("Can not merge different types of elements");
             }
 
             switch (base) {
-                case TypeQueryVisitor::String:
+                case ElementKind::String:
                     ElementMerge<StringElement>{}(*result, *e);
                     return;
 
-                case TypeQueryVisitor::Number:
+                case ElementKind::Number:
                     ElementMerge<NumberElement>{}(*result, *e);
                     return;
 
-                case TypeQueryVisitor::Boolean:
+                case ElementKind::Boolean:
                     ElementMerge<BooleanElement>{}(*result, *e);
                     return;
 
-                case TypeQueryVisitor::Array:
+                case ElementKind::Array:
                     ElementMerge<ArrayElement>{}(*result, *e);
                     return;
 
-                case TypeQueryVisitor::Object:
+                case ElementKind::Object:
                     ElementMerge<ObjectElement>{}(*result, *e);
                     return;
 
-                case TypeQueryVisitor::Enum:
+                case ElementKind::Enum:
                     ElementMerge<EnumElement>{}(*result, *e);
                     return;
 
-                case TypeQueryVisitor::Ref:
+                case ElementKind::Ref:
                     ElementMerge<RefElement>{}(*result, *e);
                     return;
 
-                case TypeQueryVisitor::Member:
-                case TypeQueryVisitor::Extend:
-                case TypeQueryVisitor::Null:
+                case ElementKind::Member:
+                case ElementKind::Extend:
+                case ElementKind::Null:
                     throw LogicError("Unappropriate kind of element to merging");
                 default:
                     throw LogicError("Element has no implemented merging");
@@ -8,6 +8,11 @@
 
 #include "Number.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+
 #include "Traits.h"
 #include "../../utils/log/Trivial.h"
 
@@ -31,25 +36,85 @@ static_assert(!supports_merge<Number>::value, "");
 static_assert(!is_iterable<Number>::value, "");
 static_assert(!is_pair<Number>::value, "");
 
-Number::Number(std::string v) noexcept : value_(v) {}
+namespace
+{
+    // digits without leading zeros, optionally negative, not "-0"
+    bool isCanonicalInteger(const std::string& v) noexcept
+    {
+        const std::size_t first = (!v.empty() && v[0] == '-') ? 1 : 0;
+        const std::size_t digits = v.size() - first;
+
+        if (digits == 0 || digits > std::numeric_limits<std::int64_t>::digits10 + 1)
+            return false;
+
+        if (v[first] == '0' && (digits > 1 || first))
+            return false;
+
+        return std::all_of(v.begin() + first, v.end(), [](char c) { return c >= '0' && c <= '9'; });
+    }
+}
+
+void Number::assign(long long v) noexcept
+{
+    integer_ = v;
+}
+
+void Number::assign(unsigned long long v)
+{
+    if (v <= static_cast<unsigned long long>(std::numeric_limits<std::int64_t>::max())) {
+        integer_ = static_cast<std::int64_t>(v);
+    } else {
+        lexeme_ = std::to_string(v);
+        real_ = static_cast<double>(v);
+        integral_ = false;
+    }
+}
+
+Number::Number(std::string v) noexcept
+{
+    if (isCanonicalInteger(v)) {
+        errno = 0;
+        const long long value = std::strtoll(v.c_str(), nullptr, 10);
+
+        if (errno != ERANGE) {
+            integer_ = value;
+            return;
+        }
+    }
+
+    real_ = std::strtod(v.c_str(), nullptr);
+    integral_ = false;
+    lexeme_ = std::move(v);
+}
 
-const std::string& Number::get() const noexcept
+std::string Number::get() const
 {
-    return value_;
+    return integral_ ? std::to_string(integer_) : lexeme_;
 }
 
 Number::operator std::int64_t() const noexcept
 {
-    std::string::size_type idx;
-    std::int64_t result = std::stoi(value_, &idx);
-    if (idx < value_.size())
-        LOG(warning) << "dsd::Number to int; dropped trailing `" << value_.substr(idx) << "`";
+    if (integral_)
+        return integer_;
+
+    char* end = nullptr;
+    std::int64_t result = std::strtoll(lexeme_.c_str(), &end, 10);
+    if (*end)
+        LOG(warning) << "dsd::Number to int; dropped trailing `" << end << "`";
     return result;
 }
 
+Number::operator double() const noexcept
+{
+    return integral_ ? static_cast<double>(integer_) : real_;
+}
+
 bool dsd::operator==(const Number& lhs, const Number& rhs) noexcept
 {
-    return lhs.get() == rhs.get();
+    if (lhs.integral_ && rhs.integral_)
+        return lhs.integer_ == rhs.integer_;
+
+    return lhs.integral_ == rhs.integral_ && lhs.lexeme_ == rhs.lexeme_;
 }
 
 bool dsd::operator!=(const Number& lhs, const Number& rhs) noexcept
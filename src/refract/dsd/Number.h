@@ -25,7 +25,15 @@ namespace refract
         ///
         class Number final
         {
-            std::string value_ = "0"; //< value
+            std::string lexeme_; //< original text, empty when integer_ renders it exactly
+            union {
+                std::int64_t integer_ = 0;
+                double real_;
+            };
+            bool integral_ = true; //< whether integer_ or real_ is set
+
+            void assign(long long v) noexcept;
+            void assign(unsigned long long v);
 
         public:
             static const char* name; //< syntactical name of the DSD
@@ -39,26 +47,57 @@ namespace refract
             ///
             /// Initialize a Number DSD from a value
             ///
-            /// @value  value to be consumed
+            /// @value  textual value, kept unless it is an integer in
+            ///         canonical form
             ///
             explicit Number(std::string v) noexcept;
 
+            ///
+            /// Initialize a Number DSD from an integer
+            ///
+            /// Unsigned values above std::int64_t are kept as text, which
+            /// may throw std::bad_alloc.
+            ///
             template <typename N, typename = typename std::enable_if<std::is_integral<N>::value>::type>
-            explicit Number(N v) noexcept : value_(std::to_string(v))
+            explicit Number(N v) noexcept(std::is_signed<N>::value)
             {
+                using Wide = typename std::conditional<std::is_signed<N>::value, long long, unsigned long long>::type;
+                assign(static_cast<Wide>(v));
             }
 
+            Number(const Number&) = default;
+            Number(Number&&) noexcept = default;
+            Number& operator=(const Number&) = default;
+            Number& operator=(Number&&) noexcept = default;
+
             ///
             /// Query the value of this Number DSD
             ///
-            /// @returns the value
+            /// @returns the original text of the value, or the canonical
+            ///          form of an integer value
+            ///
+            std::string get() const;
+
+            ///
+            /// Query whether the value is an integer representable
+            /// by std::int64_t
             ///
-            const std::string& get() const noexcept;
+            bool isInteger() const noexcept
+            {
+                return integral_;
+            }
 
             ///
             /// Parse this Number DSD as an integer
             ///
             explicit operator std::int64_t() const noexcept;
+
+            ///
+            /// Query the value of this Number DSD as a floating point number
+            ///
+            explicit operator double() const noexcept;
+
+            friend bool operator==(const Number&, const Number&) noexcept;
         };
 
         bool operator==(const Number&, const Number&) noexcept;
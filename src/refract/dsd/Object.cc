@@ -64,9 +64,9 @@ void Object::push_back(std::unique_ptr<IElement> el)
     assert(el);
 
     if (!empty())
-        if (auto mbr = TypeQueryVisitor::as<const MemberElement>(el.get()))
+        if (auto mbr = dyn_cast<const MemberElement>(el.get()))
             if (!mbr->empty() && mbr->get().key())
-                if (auto str = TypeQueryVisitor::as<const StringElement>(mbr->get().key()))
+                if (auto str = dyn_cast<const StringElement>(mbr->get().key()))
                     if (!str->empty()) {
                         auto it = find(str->get().get());
                         if (it != end())
@@ -93,10 +93,10 @@ Object::iterator Object::erase(Object::const_iterator b, Object::const_iterator
 Object::iterator Object::find(const std::string& name)
 {
     return std::find_if(begin(), end(), [&name](const auto& entry) {
-        if (auto mbr = TypeQueryVisitor::as<const MemberElement>(entry.get())) {
+        if (auto mbr = dyn_cast<const MemberElement>(entry.get())) {
             if (mbr->empty())
                 return false;
-            if (auto key = TypeQueryVisitor::as<const StringElement>(mbr->get().key()))
+            if (auto key = dyn_cast<const StringElement>(mbr->get().key()))
                 return !key->empty() && (key->get().get() == name);
         }
         return false;
@@ -0,0 +1,46 @@
+//
+//  refract/dsd/SourceMap.cc
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "SourceMap.h"
+
+#include <cassert>
+#include "Traits.h"
+
+using namespace refract;
+using namespace dsd;
+
+const char* SourceMap::name = "sourceMap";
+
+static_assert(!supports_erase<SourceMap>::value, "");
+static_assert(!supports_empty<SourceMap>::value, "");
+static_assert(!supports_insert<SourceMap>::value, "");
+static_assert(!supports_push_back<SourceMap>::value, "");
+static_assert(!supports_begin<SourceMap>::value, "");
+static_assert(!supports_end<SourceMap>::value, "");
+static_assert(!supports_size<SourceMap>::value, "");
+static_assert(!supports_merge<SourceMap>::value, "");
+static_assert(!is_iterable<SourceMap>::value, "");
+static_assert(!supports_key<SourceMap>::value, "");
+static_assert(!supports_value<SourceMap>::value, "");
+static_assert(!is_pair<SourceMap>::value, "");
+static_assert(!has_children<SourceMap>::value, "");
+
+SourceMap::SourceMap(Ranges ranges) : ranges_(std::move(ranges))
+{
+    assert(ranges_.size() % 2 == 0);
+}
+
+void SourceMap::addRange(Position location, Position length)
+{
+    ranges_.push_back(location);
+    ranges_.push_back(length);
+}
+
+bool dsd::operator==(const SourceMap& l, const SourceMap& r) noexcept
+{
+    return l.ranges() == r.ranges();
+}
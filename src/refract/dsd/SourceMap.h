@@ -0,0 +1,89 @@
+//
+//  refract/dsd/SourceMap.h
+//  librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#ifndef REFRACT_DSD_SOURCEMAP_H
+#define REFRACT_DSD_SOURCEMAP_H
+
+#include <cstddef>
+#include <vector>
+
+namespace refract
+{
+    namespace dsd
+    {
+        ///
+        /// Data structure definition (DSD) of a Refract Source Map Element
+        ///
+        /// @remark Defined by character ranges of the source document,
+        /// stored as a flat sequence of location and length pairs
+        ///
+        /// Serialized as `sourceMap` Element holding an Array of two Numbers
+        /// per range, the same shape as if the ranges were built of Array and
+        /// Number Elements.
+        ///
+        class SourceMap final
+        {
+        public:
+            using Position = std::size_t;
+            using Ranges = std::vector<Position>;
+
+            static const char* name; //< syntactical name of the DSD
+
+        private:
+            Ranges ranges_; // location, length of the first range, ...
+
+        public:
+            ///
+            /// Initialize a Source Map DSD without ranges
+            ///
+            SourceMap() = default;
+
+            ///
+            /// Initialize a Source Map DSD from location and length pairs
+            ///
+            /// @param ranges   location and length of each range
+            ///
+            explicit SourceMap(Ranges ranges);
+
+        public:
+            ///
+            /// Append a range
+            ///
+            void addRange(Position location, Position length);
+
+            ///
+            /// Number of ranges
+            ///
+            std::size_t rangeCount() const noexcept
+            {
+                return ranges_.size() / 2;
+            }
+
+            Position location(std::size_t range) const noexcept
+            {
+                return ranges_[2 * range];
+            }
+
+            Position length(std::size_t range) const noexcept
+            {
+                return ranges_[2 * range + 1];
+            }
+
+            ///
+            /// Location and length pairs of all ranges
+            ///
+            const Ranges& ranges() const noexcept
+            {
+                return ranges_;
+            }
+        };
+
+        bool operator==(const SourceMap&, const SourceMap&) noexcept;
+    }
+}
+
+#endif
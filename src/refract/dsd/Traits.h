@@ -73,12 +73,25 @@ namespace refract
         template <typename T>
         using supports_value = decltype(supports_value_test(std::declval<T>()));
 
+        template <typename T, typename = decltype(std::declval<T>().data())>
+        std::true_type supports_data_test(const T&);
+        std::false_type supports_data_test(...);
+        template <typename T>
+        using supports_data = decltype(supports_data_test(std::declval<T>()));
+
         template <typename T>
         using is_iterable = std::integral_constant<bool, supports_begin<T>::value && supports_end<T>::value>;
 
         template <typename T>
         using is_pair = std::integral_constant<bool, supports_key<T>::value && supports_value<T>::value>;
 
+        ///
+        /// Whether DSD owns nested Elements
+        ///
+        template <typename T>
+        using has_children = std::integral_constant<bool,
+            is_iterable<T>::value || supports_value<T>::value || supports_data<T>::value>;
+
         ///
         /// CRTP implementing a common interface to classes holding an STL container
         ///
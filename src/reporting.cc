@@ -9,13 +9,13 @@
 #include "reporting.h"
 
 #include <algorithm>
+#include <iomanip>
 #include <iostream>
 
 #include "refract/Element.h"
 #include "refract/FilterVisitor.h"
 #include "refract/Query.h"
 #include "refract/Iterate.h"
-#include "refract/TypeQueryVisitor.h"
 
 #include "refract/VisitorUtils.h"
 #include "SourceMapUtils.h"
@@ -90,21 +90,22 @@ namespace
         std::vector<size_t> linesEndIndex;
         const bool useLineNumbers;
 
-        AnnotationToString(const std::string& source, const bool useLineNumbers) : useLineNumbers(useLineNumbers)
+        AnnotationToString(const char* source, const size_t length, const bool useLineNumbers)
+            : useLineNumbers(useLineNumbers)
         {
             if (useLineNumbers) {
-                linesEndIndex = GetLinesEndIndex(source);
+                linesEndIndex = GetLinesEndIndex(source, length);
             }
         }
 
         const std::string location(const IElement* sourceMap)
         {
             std::stringstream output;
-            auto map = TypeQueryVisitor::as<const ArrayElement>(sourceMap);
+            auto map = dyn_cast<const ArrayElement>(sourceMap);
             if (map && map->get().size() == 2) {
 
-                auto loc = TypeQueryVisitor::as<const NumberElement>(map->get().begin()[0].get());
-                auto len = TypeQueryVisitor::as<const NumberElement>(map->get().begin()[1].get());
+                auto loc = dyn_cast<const NumberElement>(map->get().begin()[0].get());
+                auto len = dyn_cast<const NumberElement>(map->get().begin()[1].get());
                 if (loc && len) {
 
                     if (useLineNumbers) {
@@ -127,13 +128,13 @@ namespace
         {
             std::stringstream output;
 
-            if (!annotation || annotation->element() != "annotation") {
+            if (!annotation || annotation->element() != refract::sym::annotation) {
                 return output.str();
             }
 
             if (auto classes = FindCollectionMemberValue<ArrayElement>(annotation->meta(), "classes")) {
                 if (classes->get().size() == 1) {
-                    if (auto type = TypeQueryVisitor::as<const StringElement>(classes->get().begin()[0].get())) {
+                    if (auto type = dyn_cast<const StringElement>(classes->get().begin()[0].get())) {
                         output << type->get() << ": ";
                     }
                 }
@@ -144,14 +145,14 @@ namespace
                 output << "(" << code->get() << ")  ";
             }
 
-            if (const StringElement* message = TypeQueryVisitor::as<StringElement>(annotation)) {
+            if (const StringElement* message = dyn_cast<StringElement>(annotation)) {
                 output << message->get();
             }
 
             if (const ArrayElement* sourceMap
                 = FindCollectionMemberValue<ArrayElement>(annotation->attributes(), "sourceMap")) {
                 if (sourceMap->get().size() == 1) {
-                    sourceMap = TypeQueryVisitor::as<const ArrayElement>(sourceMap->get().begin()[0].get());
+                    sourceMap = dyn_cast<const ArrayElement>(sourceMap->get().begin()[0].get());
                     if (sourceMap) {
                         for (const auto& array : sourceMap->get()) {
                             if (!useLineNumbers) {
@@ -192,10 +193,19 @@ void PrintReport(const snowcrash::Report& report, const std::string& source, con
 }
 
 void PrintReport(const drafter_result* result, const std::string& source, const bool useLineNumbers, const int error)
+{
+    PrintReport(result, source.data(), source.length(), useLineNumbers, error);
+}
+
+void PrintReport(const drafter_result* result,
+    const char* source,
+    const size_t length,
+    const bool useLineNumbers,
+    const int error)
 {
     std::cerr << std::endl;
 
-    FilterVisitor filter(query::Element("annotation"));
+    FilterVisitor filter(query::Element(sym::annotation));
     Iterate<Children> iterate(filter);
     iterate(*result);
 
@@ -206,5 +216,41 @@ void PrintReport(const drafter_result* result, const std::string& source, const
     std::transform(filter.elements().begin(),
         filter.elements().end(),
         std::ostream_iterator<std::string>(std::cerr, "\n"),
-        AnnotationToString(source, useLineNumbers));
+        AnnotationToString(source, length, useLineNumbers));
+}
+
+namespace
+{
+    void PrintStage(const char* name, uint64_t ns, const drafter_alloc_stats& alloc, bool allocations)
+    {
+        std::cerr << "  " << std::left << std::setw(13) << name << std::right << std::setw(10) << ns / 1e6 << " ms";
+
+        if (allocations) {
+            std::cerr << std::setw(10) << alloc.allocations << " allocs" << std::setw(12) << alloc.bytes << " bytes"
+                      << std::setw(12) << alloc.peak_bytes << " peak";
+        }
+
+        std::cerr << "\n";
+    }
+}
+
+void PrintStats(const drafter_parse_stats& stats)
+{
+    // allocations are counted only by DRAFTER_ALLOC_STATS builds
+    const bool allocations = stats.total_alloc.allocations > 0;
+
+    std::cerr << std::fixed << std::setprecision(3);
+    std::cerr << "\nstats:\n";
+    PrintStage("parse:", stats.parse_ns, stats.parse_alloc, allocations);
+    PrintStage("register:", stats.register_ns, stats.register_alloc, allocations);
+    PrintStage("refract:", stats.refract_ns, stats.refract_alloc, allocations);
+    PrintStage("expand:", stats.expand_ns, stats.expand_alloc, allocations);
+    PrintStage("json body:", stats.json_body_ns, stats.json_body_alloc, allocations);
+    PrintStage("json schema:", stats.json_schema_ns, stats.json_schema_alloc, allocations);
+    PrintStage("total:", stats.total_ns, stats.total_alloc, allocations);
+    std::cerr << "  expand calls: " << stats.expand_calls << "\n";
+    std::cerr << "  json bodies:  " << stats.json_bodies << "\n";
+    std::cerr << "  json schemas: " << stats.json_schemas << "\n";
+    std::cerr << "  clones:       " << stats.element_clones << " elements, " << stats.data_copies << " contents\n";
+    std::cerr << "  elements:     " << stats.elements << "\n";
 }
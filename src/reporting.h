@@ -31,4 +31,26 @@ void PrintReport(const snowcrash::Report& report, const std::string& source, con
  */
 void PrintReport(const drafter_result*, const std::string& source, const bool useLineNumbers, const int error);
 
+/**
+ *  \brief Print parser report to stderr.
+ *
+ *  \param report A parser report to print
+ *  \param source Source data, need not be NUL-terminated
+ *  \param length Length of source data in bytes
+ *  \param useLineNumbers True if the annotations needs to be printed by line and column number
+ *  \param error - code form parsing
+ */
+void PrintReport(const drafter_result*,
+    const char* source,
+    const size_t length,
+    const bool useLineNumbers,
+    const int error);
+
+/**
+ *  \brief Print parsing statistics to stderr.
+ *
+ *  \param stats Statistics collected by drafter_parse_blueprint_with_stats()
+ */
+void PrintStats(const drafter_parse_stats& stats);
+
 #endif // #ifndef DRAFTER_REPORTING_H
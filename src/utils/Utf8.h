@@ -201,7 +201,7 @@ namespace drafter
                 using reference = const codepoint&;
                 using pointer = const codepoint*;
                 using iterator_category = std::input_iterator_tag;
-                using difference_type = typename It::difference_type;
+                using difference_type = typename std::iterator_traits<It>::difference_type;
 
             public:
                 template <typename ItT>
@@ -55,23 +55,24 @@ const char* log::severity_to_str(severity s)
     }
 }
 
+// Entries lock the log only when they are going to be written, so
+// disabled logging does not serialize concurrently running parsers
 trivial_entry::trivial_entry(trivial_log& log, severity svrty, size_t line, const char* file)
-    : log_(log), severity_(svrty), log_lock_(log_.mtx())
+    : out_(enough_severity(svrty) ? log.out() : nullptr), log_lock_(log.mtx(), std::defer_lock)
 {
-    if (enough_severity(severity_))
-        if (auto* out = log_.out()) {
-            *out << '[' << severity_to_str(svrty) << "]";
-            *out << '[' << std::this_thread::get_id() << "]";
-            *out << '[' << file << ':' << line << "] ";
-        }
+    if (out_) {
+        log_lock_.lock();
+        *out_ << '[' << severity_to_str(svrty) << "]";
+        *out_ << '[' << std::this_thread::get_id() << "]";
+        *out_ << '[' << file << ':' << line << "] ";
+    }
 }
 
 trivial_entry::~trivial_entry()
 {
-    if (enough_severity(severity_))
-        if (auto* out = log_.out()) {
-            *out << '\n'; // TODO @tjanc@ could throw
-        }
+    if (out_) {
+        *out_ << '\n'; // TODO @tjanc@ could throw
+    }
 }
 
 std::mutex& trivial_log::mtx() const
@@ -81,7 +82,7 @@ std::mutex& trivial_log::mtx() const
 
 std::ostream* trivial_log::out()
 {
-    return out_;
+    return out_.load(std::memory_order_acquire);
 }
 
 void trivial_log::enable()
@@ -89,6 +90,6 @@ void trivial_log::enable()
     std::lock_guard<std::mutex> lock(write_mtx_);
 #ifdef LOGGING
     static std::ofstream log_file_{ "drafter.log" };
-    out_ = &log_file_;
+    out_.store(&log_file_, std::memory_order_release);
 #endif
 }
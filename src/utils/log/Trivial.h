@@ -9,6 +9,7 @@
 #ifndef DRAFTER_UTILS_LOG_TRIVIAL_H
 #define DRAFTER_UTILS_LOG_TRIVIAL_H
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <ostream>
@@ -39,9 +40,8 @@ namespace drafter
 
             class trivial_entry
             {
-                trivial_log& log_;
-                severity severity_;
-                std::lock_guard<std::mutex> log_lock_;
+                std::ostream* out_; // nullptr unless logging is enabled and severity is high enough
+                std::unique_lock<std::mutex> log_lock_;
 
             public:
                 trivial_entry(trivial_log& log, severity svrty, size_t line, const char* file);
@@ -61,7 +61,7 @@ namespace drafter
             class trivial_log
             {
                 mutable std::mutex write_mtx_;
-                std::ostream* out_ = nullptr;
+                std::atomic<std::ostream*> out_{ nullptr };
 
             public:
                 static trivial_log& instance();
@@ -78,8 +78,8 @@ namespace drafter
             template <typename T>
             trivial_entry& trivial_entry::operator<<(T&& obj)
             {
-                if (auto* out = log_.out())
-                    *out << std::forward<T>(obj);
+                if (out_)
+                    *out_ << std::forward<T>(obj);
                 return *this;
             }
         } // namespace log
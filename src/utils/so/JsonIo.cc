@@ -9,6 +9,7 @@
 #include "JsonIo.h"
 
 #include <algorithm>
+#include <cassert>
 #include <cstdio>
 #include <cmath>
 #include <iostream>
@@ -105,93 +106,117 @@ namespace
             out << "  ";
         return out;
     }
+} // namespace
 
-    template <bool Packed = true>
-    struct json_printer final {
-        void operator()(const Null& value, std::ostream& out, int indent = 0) const
-        {
-            out << "null";
-        }
+std::ostream& so::serialize_json(std::ostream& out, const Value& obj)
+{
+    json_writer writer(out);
+    describe(writer, obj);
+    return out;
+}
 
-        void operator()(const True& value, std::ostream& out, int indent = 0) const
-        {
-            out << "true";
-        }
+std::ostream& so::serialize_json(std::ostream& out, const Value& obj, packed)
+{
+    json_writer writer(out, packed{});
+    describe(writer, obj);
+    return out;
+}
 
-        void operator()(const False& value, std::ostream& out, int indent = 0) const
-        {
-            out << "false";
-        }
+json_writer::json_writer(std::ostream& out) : out_(out), packed_(false) {}
 
-        void operator()(const String& value, std::ostream& out, int indent = 0) const
-        {
-            out << '"';
-            escape_json_string( //
-                value.data.begin(),
-                value.data.end(),
-                std::ostream_iterator<char>(out));
-            out << '"';
-        }
+json_writer::json_writer(std::ostream& out, packed) : out_(out), packed_(true) {}
 
-        void operator()(const Number& value, std::ostream& out, int indent = 0) const
-        {
-            out << value.data;
-        }
+void json_writer::begin_value()
+{
+    if (open_.empty() || open_.back().object)
+        return; // top level or preceded by key()
 
-        void operator()(const Object& value, std::ostream& out, int indent = 0) const
-        {
-            out << '{';
-            int commas = value.data.size() - 1;
-            for (const auto& m : value.data) {
-                if (!Packed)
-                    break_indent(out, indent + 1);
+    if (!open_.back().empty)
+        out_ << ',';
+    open_.back().empty = false;
 
-                out << '"' << m.first << "\":";
+    if (!packed_)
+        break_indent(out_, static_cast<int>(open_.size()));
+}
 
-                if (!Packed)
-                    out << ' ';
+void json_writer::begin_container(bool object, char c)
+{
+    begin_value();
+    out_ << c;
+    open_.push_back({ object, true });
+}
 
-                visit(m.second, *this, out, indent + 1);
+void json_writer::end_container(char c)
+{
+    assert(!open_.empty());
+    if (!(packed_ || open_.back().empty))
+        break_indent(out_, static_cast<int>(open_.size()) - 1);
+    out_ << c;
+    open_.pop_back();
+}
 
-                if (commas > 0) {
-                    out << ',';
-                    --commas;
-                }
-            }
-            if (!(Packed || value.data.empty()))
-                break_indent(out, indent);
-            out << '}';
-        }
+void json_writer::begin_object()
+{
+    begin_container(true, '{');
+}
 
-        void operator()(const Array& value, std::ostream& out, int indent = 0) const
-        {
-            out << '[';
-            int commas = value.data.size() - 1;
-            for (const auto& m : value.data) {
-                if (!Packed)
-                    break_indent(out, indent + 1);
-                visit(m, *this, out, indent + 1);
-
-                if (commas > 0) {
-                    out << ',';
-                    --commas;
-                }
-            }
-            if (!(Packed || value.data.empty()))
-                break_indent(out, indent);
-            out << ']';
-        }
-    };
-} // namespace
+void json_writer::end_object()
+{
+    end_container('}');
+}
 
-std::ostream& so::serialize_json(std::ostream& out, const Value& obj)
+void json_writer::begin_array()
 {
-    visit(obj, json_printer<false>{}, out);
-    return out;
+    begin_container(false, '[');
 }
 
-std::ostream& so::serialize_json(std::ostream& out, const Value& obj, packed)
+void json_writer::end_array()
 {
-    visit(obj, json_printer<true>{}, out);
-    return out;
+    end_container(']');
+}
+
+void json_writer::key(const std::string& key)
+{
+    assert(!open_.empty() && open_.back().object);
+
+    if (!open_.back().empty)
+        out_ << ',';
+    open_.back().empty = false;
+
+    if (!packed_)
+        break_indent(out_, static_cast<int>(open_.size()));
+
+    out_ << '"' << key << "\":";
+
+    if (!packed_)
+        out_ << ' ';
+}
+
+void json_writer::null()
+{
+    begin_value();
+    out_ << "null";
+}
+
+void json_writer::boolean(bool value)
+{
+    begin_value();
+    out_ << (value ? "true" : "false");
+}
+
+void json_writer::string(const std::string& value)
+{
+    begin_value();
+    out_ << '"';
+    escape_json_string( //
+        value.begin(),
+        value.end(),
+        std::ostreambuf_iterator<char>(out_));
+    out_ << '"';
+}
+
+void json_writer::number(const std::string& value)
+{
+    begin_value();
+    out_ << value;
 }
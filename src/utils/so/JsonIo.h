@@ -9,6 +9,8 @@
 #ifndef DRAFTER_UTILS_SO_JSONIO_H
 #define DRAFTER_UTILS_SO_JSONIO_H
 
+#include <vector>
+
 #include "Value.h"
 
 namespace drafter
@@ -22,6 +24,44 @@ namespace drafter
 
             std::ostream& serialize_json(std::ostream& out, const Value& obj);
             std::ostream& serialize_json(std::ostream& out, const Value& obj, packed);
+
+            ///
+            /// Write JSON of a value described call by call, without building
+            /// the Value first
+            ///
+            /// Every value of an object is preceded by its key(). Output is the
+            /// same as of serialize_json() called on the described Value.
+            ///
+            class json_writer final
+            {
+                struct container {
+                    bool object;
+                    bool empty;
+                };
+
+                std::ostream& out_;
+                const bool packed_;
+                std::vector<container> open_;
+
+                void begin_value();
+                void begin_container(bool object, char c);
+                void end_container(char c);
+
+            public:
+                explicit json_writer(std::ostream& out);
+                json_writer(std::ostream& out, packed);
+
+                void begin_object();
+                void end_object();
+                void begin_array();
+                void end_array();
+                void key(const std::string& key);
+
+                void null();
+                void boolean(bool value);
+                void string(const std::string& value);
+                void number(const std::string& value);
+            };
         }
     }
 }
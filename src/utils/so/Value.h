@@ -139,6 +139,63 @@ namespace drafter
             void emplace_unique(Array& c, Value&& value);
 
             Value* find(Object& c, const std::string& key);
+
+            ///
+            /// Describe a Value to a writer, see json_writer
+            ///
+            template <typename Writer>
+            struct value_describer final {
+                Writer& writer;
+
+                void operator()(const Null&) const
+                {
+                    writer.null();
+                }
+
+                void operator()(const True&) const
+                {
+                    writer.boolean(true);
+                }
+
+                void operator()(const False&) const
+                {
+                    writer.boolean(false);
+                }
+
+                void operator()(const String& value) const
+                {
+                    writer.string(value.data);
+                }
+
+                void operator()(const Number& value) const
+                {
+                    writer.number(value.data);
+                }
+
+                void operator()(const Object& value) const
+                {
+                    writer.begin_object();
+                    for (const auto& m : value.data) {
+                        writer.key(m.first);
+                        visit(m.second, *this);
+                    }
+                    writer.end_object();
+                }
+
+                void operator()(const Array& value) const
+                {
+                    writer.begin_array();
+                    for (const auto& m : value.data)
+                        visit(m, *this);
+                    writer.end_array();
+                }
+            };
+
+            template <typename Writer>
+            void describe(Writer& writer, const Value& value)
+            {
+                visit(value, value_describer<Writer>{ writer });
+            }
         } // namespace so
     }     // namespace utils
 } // namespace drafter
@@ -13,7 +13,6 @@
 #include <exception>
 #include <iostream>
 #include <iterator>
-#include <regex>
 
 #include "../Utf8.h"
 #include "../Utils.h"
@@ -29,8 +28,9 @@ namespace
 
     bool is_alphanum_dash(const std::string& str)
     {
-        thread_local const std::regex r{ "[a-zA-Z0-9-]+" };
-        return std::regex_match(str.begin(), str.end(), r);
+        return !str.empty() && std::all_of(str.begin(), str.end(), [](char c) {
+            return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '-';
+        });
     }
 
     bool is_yaml_printable(const codepoint& c)
@@ -149,7 +149,7 @@ namespace
         return out;
     }
 
-    std::ostream& serialize_yaml(std::ostream& out, const std::string& obj)
+    std::ostream& serialize_yaml_string(std::ostream& out, const std::string& obj)
     {
         out << '"';
         escape_yaml_string( //
@@ -166,112 +166,105 @@ namespace
             out << "  ";
         return out;
     }
+} // namespace
 
-    struct yaml_printer final {
-        void operator()(const Null& value, std::ostream& out, int indent = 0) const
-        {
-            if (indent > 0)
-                out << ' ';
-
-            out << "null";
-        }
-
-        void operator()(const True& value, std::ostream& out, int indent = 0) const
-        {
-            if (indent > 0)
-                out << ' ';
-
-            out << "true";
-        }
-
-        void operator()(const False& value, std::ostream& out, int indent = 0) const
-        {
-            if (indent > 0)
-                out << ' ';
-
-            out << "false";
-        }
+std::ostream& so::serialize_yaml(std::ostream& out, const Value& obj)
+{
+    yaml_writer writer(out);
+    describe(writer, obj);
+    return out;
+}
 
-        void operator()(const String& value, std::ostream& out, int indent = 0) const
-        {
-            if (indent > 0)
-                out << ' ';
+yaml_writer::yaml_writer(std::ostream& out) : out_(out) {}
 
-            serialize_yaml(out, value.data);
-        }
+void yaml_writer::begin_value()
+{
+    if (open_.empty())
+        return;
 
-        void operator()(const Number& value, std::ostream& out, int indent = 0) const
-        {
-            if (indent > 0)
-                out << ' ';
+    if (!open_.back().object)
+        begin_entry();
 
-            out << value.data;
-        }
+    out_ << ' ';
+}
 
-        void operator()(const Object& value, std::ostream& out, int indent = 0) const
-        {
-            if (value.data.empty()) {
-                if (indent > 0)
-                    out << ' ';
-                out << "{}";
-                return;
-            }
+void yaml_writer::begin_entry()
+{
+    // containers are only known to be non-empty with their first entry
+    if (!open_.back().empty || open_.back().indent > 0)
+        out_ << '\n';
+    open_.back().empty = false;
 
-            if (indent > 0)
-                out << '\n';
+    do_indent(out_, open_.back().indent);
 
-            int newlines = value.data.size() - 1;
-            for (const auto& m : value.data) {
-                do_indent(out, indent);
+    if (!open_.back().object)
+        out_ << '-';
+}
 
-                // for clearer, unescaped reading
-                if (is_alphanum_dash(m.first))
-                    out << m.first;
-                else
-                    serialize_yaml(out, m.first);
+void yaml_writer::begin_object()
+{
+    if (!open_.empty() && !open_.back().object)
+        begin_entry();
+    open_.push_back({ true, true, static_cast<int>(open_.size()) });
+}
 
-                out << ":";
+void yaml_writer::end_object()
+{
+    assert(!open_.empty());
+    if (open_.back().empty)
+        out_ << (open_.back().indent > 0 ? " {}" : "{}");
+    open_.pop_back();
+}
 
-                visit(m.second, *this, out, indent + 1);
+void yaml_writer::begin_array()
+{
+    if (!open_.empty() && !open_.back().object)
+        begin_entry();
+    open_.push_back({ false, true, static_cast<int>(open_.size()) });
+}
 
-                if (newlines > 0) {
-                    out << '\n';
-                    --newlines;
-                }
-            }
-        }
+void yaml_writer::end_array()
+{
+    assert(!open_.empty());
+    if (open_.back().empty)
+        out_ << (open_.back().indent > 0 ? " []" : "[]");
+    open_.pop_back();
+}
 
-        void operator()(const Array& value, std::ostream& out, int indent = 0) const
-        {
-            if (value.data.empty()) {
-                if (indent > 0)
-                    out << ' ';
-                out << "[]";
-                return;
-            }
+void yaml_writer::key(const std::string& key)
+{
+    assert(!open_.empty() && open_.back().object);
+    begin_entry();
 
-            if (indent > 0)
-                out << '\n';
+    // for clearer, unescaped reading
+    if (is_alphanum_dash(key))
+        out_ << key;
+    else
+        serialize_yaml_string(out_, key);
 
-            int newlines = value.data.size() - 1;
-            for (const auto& m : value.data) {
-                do_indent(out, indent);
+    out_ << ":";
+}
 
-                out << '-';
+void yaml_writer::null()
+{
+    begin_value();
+    out_ << "null";
+}
 
-                visit(m, *this, out, indent + 1);
+void yaml_writer::boolean(bool value)
+{
+    begin_value();
+    out_ << (value ? "true" : "false");
+}
 
-                if (newlines > 0) {
-                    out << '\n';
-                    --newlines;
-                }
-            }
-        }
-    };
-} // namespace
+void yaml_writer::string(const std::string& value)
+{
+    begin_value();
+    serialize_yaml_string(out_, value);
+}
 
-std::ostream& so::serialize_yaml(std::ostream& out, const Value& obj)
+void yaml_writer::number(const std::string& value)
 {
-    visit(obj, yaml_printer{}, out);
-    return out;
+    begin_value();
+    out_ << value;
 }
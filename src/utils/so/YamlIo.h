@@ -9,6 +9,8 @@
 #ifndef DRAFTER_UTILS_SO_YAMLIO_H
 #define DRAFTER_UTILS_SO_YAMLIO_H
 
+#include <vector>
+
 #include "Value.h"
 
 namespace drafter
@@ -18,6 +20,42 @@ namespace drafter
         namespace so
         {
             std::ostream& serialize_yaml(std::ostream& out, const Value& obj);
+
+            ///
+            /// Write YAML of a value described call by call, without building
+            /// the Value first
+            ///
+            /// Every value of an object is preceded by its key(). Output is the
+            /// same as of serialize_yaml() called on the described Value.
+            ///
+            class yaml_writer final
+            {
+                struct container {
+                    bool object;
+                    bool empty;
+                    int indent;
+                };
+
+                std::ostream& out_;
+                std::vector<container> open_;
+
+                void begin_value();
+                void begin_entry();
+
+            public:
+                explicit yaml_writer(std::ostream& out);
+
+                void begin_object();
+                void end_object();
+                void begin_array();
+                void end_array();
+                void key(const std::string& key);
+
+                void null();
+                void boolean(bool value);
+                void string(const std::string& value);
+                void number(const std::string& value);
+            };
         }
     }
 }
@@ -0,0 +1,103 @@
+//
+//  test/BlueprintBuilder.h
+//  test-drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+#ifndef DRAFTER_BLUEPRINTBUILDER_H
+#define DRAFTER_BLUEPRINTBUILDER_H
+
+#include <string>
+
+#include "Blueprint.h"
+
+namespace draftertest
+{
+    // elements of a blueprint AST built without parsing, source maps are empty
+
+    inline snowcrash::Element dataStructure(const std::string& name, const std::string& parent)
+    {
+        snowcrash::Element element(snowcrash::Element::DataStructureElement);
+        auto& ds = element.content.dataStructure;
+
+        ds.name.symbol.literal = name;
+
+        if (parent.empty())
+            ds.typeDefinition.typeSpecification.name.base = mson::ObjectTypeName;
+        else
+            ds.typeDefinition.typeSpecification.name.symbol.literal = parent;
+
+        return element;
+    }
+
+    inline void addMember(snowcrash::Element& element, const mson::Element& property)
+    {
+        mson::TypeSection members(mson::TypeSection::MemberTypeClass);
+        members.content.elements().push_back(property);
+
+        element.content.dataStructure.sections.push_back(members);
+    }
+
+    // member of a named type
+    inline void addMember(snowcrash::Element& element, const std::string& key, const std::string& type)
+    {
+        mson::Element property(mson::Element::PropertyClass);
+        property.content.property.name.literal = key;
+        property.content.property.valueDefinition.typeDefinition.typeSpecification.name.symbol.literal = type;
+
+        addMember(element, property);
+    }
+
+    // member of a base type with a value
+    inline void addMember(
+        snowcrash::Element& element, const std::string& key, mson::BaseTypeName type, const char* value)
+    {
+        mson::Element property(mson::Element::PropertyClass);
+        property.content.property.name.literal = key;
+        property.content.property.valueDefinition.typeDefinition.typeSpecification.name.base = type;
+
+        mson::Value literal;
+        literal.literal = value;
+        property.content.property.valueDefinition.values.push_back(literal);
+
+        addMember(element, property);
+    }
+
+    inline snowcrash::Element category(snowcrash::Element::Category kind)
+    {
+        snowcrash::Element element(snowcrash::Element::CategoryElement);
+        element.category = kind;
+        return element;
+    }
+
+    inline snowcrash::Element copy(const std::string& text)
+    {
+        snowcrash::Element element(snowcrash::Element::CopyElement);
+        element.content.copy = text;
+        return element;
+    }
+
+    // resource with a GET action responding with a JSON body of a named type
+    inline snowcrash::Element resource(const std::string& uri, const std::string& type)
+    {
+        snowcrash::Response response;
+        response.name = "200";
+        response.headers.push_back({ "Content-Type", "application/json" });
+        response.attributes.typeDefinition.typeSpecification.name.symbol.literal = type;
+
+        snowcrash::TransactionExample example;
+        example.responses.push_back(response);
+
+        snowcrash::Action action;
+        action.method = "GET";
+        action.examples.push_back(example);
+
+        snowcrash::Element element(snowcrash::Element::ResourceElement);
+        element.content.resource.uriTemplate = uri;
+        element.content.resource.actions.push_back(action);
+
+        return element;
+    }
+}
+
+#endif // #ifndef DRAFTER_BLUEPRINTBUILDER_H
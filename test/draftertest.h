@@ -2,6 +2,7 @@
 #define DRAFTER_DRAFTERTEST_H
 
 #include <catch2/catch.hpp>
+#include <cstdlib>
 #include "dtl.hpp"
 
 #include "RefractAPI.h"
@@ -10,10 +11,13 @@
 
 #include "stream.h"
 
+#include "refract/ElementUtils.h"
 #include "refract/SerializeSo.h"
 #include "utils/log/Trivial.h"
 #include "utils/so/JsonIo.h"
 
+#include "drafter.h"
+#include "PipelineStats.h"
 #include "Serialize.h"
 #include "SerializeResult.h"
 
@@ -47,6 +51,20 @@ namespace draftertest
         const std::string sourceMapJson = ".sourcemap.json";
     } // namespace ext
 
+    /// result serialized by the C API as JSON with source maps
+    inline std::string serializeResult(drafter_result* result)
+    {
+        drafter_serialize_options options{ true, DRAFTER_SERIALIZE_JSON };
+
+        char* out = drafter_serialize(result, options);
+        REQUIRE(out);
+
+        std::string serialized(out);
+        free(out);
+
+        return serialized;
+    }
+
     class ITFixtureFiles
     {
 
@@ -142,6 +160,23 @@ namespace draftertest
             return ext::json;
         }
 
+        /// Conversion moves the elements it creates; it clones only values
+        /// shared by an enumeration and its samples, defaults or content,
+        /// each of them no more than once. Copies made by expansion and by
+        /// generating message bodies are not part of the conversion.
+        static void checkConversionCopies(const refract::IElement& result, const drafter::PipelineStats& stats)
+        {
+            refract::CloneStats conversion = stats.refract.clones;
+            for (const auto* stage : { &stats.expand, &stats.jsonBody, &stats.jsonSchema }) {
+                conversion.elements -= stage->clones.elements;
+                conversion.data -= stage->clones.data;
+            }
+
+            INFO("Element clones: " << conversion.elements << ", data copies: " << conversion.data);
+            REQUIRE(conversion.elements <= refract::countElements(result));
+            REQUIRE(conversion.data <= conversion.elements);
+        }
+
         static bool handleResultJSON(
             const std::string& fixturePath, const drafter::WrapperOptions& options, bool mustBeOk = false)
         {
@@ -157,7 +192,14 @@ namespace draftertest
             std::ostringstream outStream;
             drafter::ConversionContext context(source.c_str(), options);
 
+            drafter::PipelineStats stats;
+            context.stats = &stats;
+
             if (auto parsed = WrapRefract(blueprint, context)) {
+                // a failed conversion drops the elements it has made
+                if (blueprint.report.error.code == snowcrash::Error::OK)
+                    checkConversionCopies(*parsed, stats);
+
                 auto soValue = refract::serialize::renderSo(*parsed, options.generateSourceMap);
                 drafter::utils::so::serialize_json(outStream, soValue);
             }
@@ -0,0 +1,442 @@
+//
+//  drafter-bench.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+#include "drafter.h"
+#include "snowcrash.h"
+#include "MarkdownParser.h"
+
+#include "AllocStats.h"
+#include "ConversionContext.h"
+#include "NamedTypesRegistry.h"
+#include "RefractAPI.h"
+#include "RefractDataStructure.h"
+#include "Serialize.h"
+
+#include "refract/Element.h"
+#include "refract/FilterVisitor.h"
+#include "refract/Iterate.h"
+#include "refract/Query.h"
+#include "refract/SerializeSo.h"
+
+#include "utils/so/JsonIo.h"
+#include "utils/so/YamlIo.h"
+
+#if defined(DRAFTER_ALLOC_STATS)
+
+//
+// Allocations are counted by drafter itself, including peak of live bytes
+//
+
+#else
+
+//
+// Allocation counting, covers all allocations made by the benchmark
+// process including snowcrash and drafter
+//
+
+namespace
+{
+    std::atomic<size_t> allocationCount{ 0 };
+    std::atomic<size_t> allocationBytes{ 0 };
+}
+
+void* operator new(size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+#endif // #if defined(DRAFTER_ALLOC_STATS)
+
+namespace
+{
+    using namespace drafter;
+
+    const char* const Phases[] = {
+        "markdown",
+        "snowcrash",
+        "register",
+        "refract",
+        "expand",
+        "renderSo",
+        "json",
+        "yaml",
+        "check",
+    };
+
+    const size_t PhaseCount = sizeof(Phases) / sizeof(Phases[0]);
+
+    struct PhaseResult {
+        double seconds = 0;
+        size_t allocations = 0;
+        size_t bytes = 0;
+        size_t peakBytes = 0; // only with DRAFTER_ALLOC_STATS
+    };
+
+    struct Document {
+        std::string name;
+        std::string source;
+    };
+
+    /// Measure time and allocations of a single phase run
+    class Measure
+    {
+        PhaseResult& result_;
+#if defined(DRAFTER_ALLOC_STATS)
+        AllocScope alloc_;
+#else
+        size_t allocations_;
+        size_t bytes_;
+#endif
+        std::chrono::steady_clock::time_point start_;
+
+    public:
+        explicit Measure(PhaseResult& result)
+            : result_(result),
+#if !defined(DRAFTER_ALLOC_STATS)
+              allocations_(allocationCount.load()),
+              bytes_(allocationBytes.load()),
+#endif
+              start_(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~Measure()
+        {
+            auto end = std::chrono::steady_clock::now();
+            result_.seconds += std::chrono::duration<double>(end - start_).count();
+#if defined(DRAFTER_ALLOC_STATS)
+            const AllocStats alloc = alloc_.get();
+            result_.allocations += alloc.allocations;
+            result_.bytes += alloc.bytes;
+            result_.peakBytes = std::max(result_.peakBytes, alloc.peakBytes);
+#else
+            result_.allocations += allocationCount.load() - allocations_;
+            result_.bytes += allocationBytes.load() - bytes_;
+#endif
+        }
+    };
+
+    void RunPhases(const Document& doc, PhaseResult (&results)[PhaseCount])
+    {
+        {
+            mdp::MarkdownParser markdownParser;
+            mdp::MarkdownNode markdownAST;
+
+            Measure m(results[0]);
+            markdownParser.parse(doc.source, markdownAST);
+        }
+
+        snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+        {
+            Measure m(results[1]);
+            snowcrash::parse(doc.source, snowcrash::ExportSourcemapOption, blueprint);
+        }
+
+        if (blueprint.report.error.code != snowcrash::Error::OK)
+            return;
+
+        WrapperOptions options;
+        ConversionContext context(doc.source.data(), doc.source.length(), options);
+        {
+            Measure m(results[2]);
+            RegisterNamedTypes(
+                MakeNodeInfo(blueprint.node.content.elements(), blueprint.sourceMap.content.elements()), context);
+        }
+
+        std::unique_ptr<refract::IElement> result;
+        {
+            Measure m(results[3]);
+            result = BlueprintToRefract(MakeNodeInfo(blueprint.node, blueprint.sourceMap), context);
+        }
+
+        refract::FilterVisitor filter(refract::query::Element(SerializeKey::DataStructure));
+        refract::Iterate<refract::Recursive> iterate(filter);
+        iterate(*result);
+        {
+            Measure m(results[4]);
+            for (const auto* dataStructure : filter.elements()) {
+                ExpandRefract(dataStructure->clone(), context);
+            }
+        }
+
+        context.GetNamedTypesRegistry().clearAll(true);
+
+        utils::so::Value soValue;
+        {
+            Measure m(results[5]);
+            soValue = refract::serialize::renderSo(*result, true);
+        }
+
+        {
+            std::ostringstream out;
+            Measure m(results[6]);
+            utils::so::serialize_json(out, soValue);
+        }
+
+        {
+            std::ostringstream out;
+            Measure m(results[7]);
+            utils::so::serialize_yaml(out, soValue);
+        }
+
+        {
+            drafter_result* annotations = nullptr;
+            Measure m(results[8]);
+            drafter_check_blueprint(doc.source.c_str(), &annotations, drafter_parse_options{ false });
+            drafter_free_result(annotations);
+        }
+    }
+
+    void Report(const std::string& name, size_t size, size_t iterations, const PhaseResult (&results)[PhaseCount])
+    {
+        const double megabytes = size / (1024.0 * 1024.0);
+
+        for (size_t i = 0; i < PhaseCount; ++i) {
+            const PhaseResult& r = results[i];
+
+            std::cout << std::left << std::setw(48) << name.substr(0, 47) << std::setw(10) << Phases[i]
+                      << std::right << std::fixed << std::setprecision(3) << std::setw(12)
+                      << (r.seconds * 1000 / iterations) << std::setw(12)
+                      << (r.seconds > 0 ? megabytes * iterations / r.seconds : 0) << std::setw(12)
+                      << (r.allocations / iterations) << std::setw(14) << (r.bytes / iterations);
+
+            if (AllocStatsEnabled())
+                std::cout << std::setw(14) << r.peakBytes;
+
+            std::cout << "\n";
+        }
+    }
+
+    /// Generate blueprint with given number of resources, named types and inheritance depth
+    Document Synthetic(size_t resources, size_t types, size_t depth)
+    {
+        std::ostringstream out;
+
+        out << "FORMAT: 1A\n\n# Synthetic API\n\n# Data Structures\n\n";
+
+        for (size_t i = 0; i < types; ++i) {
+            if (depth && i % depth)
+                out << "## Type" << i << " (Type" << (i - 1) << ")\n\n";
+            else
+                out << "## Type" << i << " (object)\n\n";
+
+            out << "+ id" << i << ": " << i << " (number, required)\n";
+            out << "+ name" << i << ": type " << i << " (string)\n";
+            out << "+ tags" << i << " (array[string])\n\n";
+        }
+
+        out << "# Group Resources\n\n";
+
+        for (size_t i = 0; i < resources; ++i) {
+            out << "## Resource " << i << " [/resources/" << i << "/{id}]\n\n";
+            out << "+ Parameters\n    + id: 1 (number) - Identifier\n\n";
+            out << "### Retrieve Resource " << i << " [GET]\n\n";
+            out << "+ Response 200 (application/json)\n\n";
+
+            if (types)
+                out << "    + Attributes (Type" << (i % types) << ")\n\n";
+            else
+                out << "    + Attributes\n        + id: 1 (number)\n\n";
+        }
+
+        std::ostringstream name;
+        name << "synthetic r=" << resources << " t=" << types << " d=" << depth;
+
+        return Document{ name.str(), out.str() };
+    }
+
+    bool ReadDocument(const std::string& path, std::vector<Document>& docs)
+    {
+        std::ifstream in(path.c_str(), std::ios_base::in | std::ios_base::binary);
+
+        if (!in.is_open())
+            return false;
+
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        docs.push_back(Document{ path, buffer.str() });
+
+        return true;
+    }
+
+    void CollectDocuments(const std::string& path, std::vector<Document>& docs)
+    {
+#if !defined(_WIN32)
+        struct stat info;
+        if (::stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode)) {
+            std::vector<std::string> entries;
+
+            if (DIR* dir = ::opendir(path.c_str())) {
+                while (struct dirent* entry = ::readdir(dir)) {
+                    const std::string name = entry->d_name;
+                    if (name != "." && name != "..")
+                        entries.push_back(name);
+                }
+                ::closedir(dir);
+            }
+
+            std::sort(entries.begin(), entries.end());
+
+            for (const auto& entry : entries) {
+                const std::string child = path + "/" + entry;
+
+                if (::stat(child.c_str(), &info) == 0 && S_ISDIR(info.st_mode))
+                    CollectDocuments(child, docs);
+                else if (child.size() > 5 && child.compare(child.size() - 5, 5, ".apib") == 0)
+                    ReadDocument(child, docs);
+            }
+
+            return;
+        }
+#endif
+        if (!ReadDocument(path, docs)) {
+            std::cerr << "fatal: unable to open input file '" << path << "'\n";
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    void help()
+    {
+        std::cout << "usage: drafter-bench [options] ... [<input file|directory> ...]\n\n";
+        std::cout << "Runs every parsing phase separately and reports time, throughput and allocations\n";
+        std::cout << "per iteration. Without inputs test/fixtures is used.\n";
+        std::cout << "The snowcrash phase includes markdown parsing, the expand phase expands every\n";
+        std::cout << "data structure of the document against its named types, the check phase\n";
+        std::cout << "runs the whole drafter_check_blueprint() validation.\n";
+        std::cout << "Peak of live bytes is reported by DRAFTER_ALLOC_STATS builds only.\n\n";
+        std::cout << "options:\n\n";
+        std::cout << "  -n <count>                    number of iterations per document (default 10)\n";
+        std::cout << "  -s <resources,types,depth>    add synthetic document, can be repeated\n";
+        std::cout << "  --no-synthetic                skip default synthetic documents\n";
+        std::cout << "  -h, --help                    display this help message\n";
+        exit(EXIT_SUCCESS);
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    size_t iterations = 10;
+    bool defaultSynthetic = true;
+    std::vector<std::string> inputs;
+    std::vector<Document> docs;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            help();
+        } else if (arg == "-n" && i + 1 < argc) {
+            iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "-s" && i + 1 < argc) {
+            size_t resources = 0, types = 0, depth = 0;
+            char separator;
+            std::istringstream spec(argv[++i]);
+            if (!(spec >> resources >> separator >> types >> separator >> depth)) {
+                std::cerr << "fatal: invalid synthetic document specification '" << argv[i] << "'\n";
+                exit(EXIT_FAILURE);
+            }
+            docs.push_back(Synthetic(resources, types, depth));
+        } else if (arg == "--no-synthetic") {
+            defaultSynthetic = false;
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+
+    if (inputs.empty())
+        inputs.push_back("test/fixtures");
+
+    for (const auto& input : inputs)
+        CollectDocuments(input, docs);
+
+    if (defaultSynthetic) {
+        docs.push_back(Synthetic(10, 10, 2));
+        docs.push_back(Synthetic(100, 50, 8));
+        docs.push_back(Synthetic(500, 200, 32));
+    }
+
+    std::cout << std::left << std::setw(48) << "document" << std::setw(10) << "phase" << std::right << std::setw(12)
+              << "ms/iter" << std::setw(12) << "MB/s" << std::setw(12) << "allocs" << std::setw(14) << "bytes";
+
+    if (AllocStatsEnabled())
+        std::cout << std::setw(14) << "peak";
+
+    std::cout << "\n";
+
+    PhaseResult totals[PhaseCount];
+    size_t totalBytes = 0;
+
+    for (const auto& doc : docs) {
+        PhaseResult results[PhaseCount];
+
+        for (size_t i = 0; i < iterations; ++i)
+            RunPhases(doc, results);
+
+        Report(doc.name, doc.source.size(), iterations, results);
+
+        for (size_t i = 0; i < PhaseCount; ++i) {
+            totals[i].seconds += results[i].seconds;
+            totals[i].allocations += results[i].allocations;
+            totals[i].bytes += results[i].bytes;
+            totals[i].peakBytes = std::max(totals[i].peakBytes, results[i].peakBytes);
+        }
+
+        totalBytes += doc.source.size();
+    }
+
+    Report("total", totalBytes, iterations, totals);
+
+    return EXIT_SUCCESS;
+}
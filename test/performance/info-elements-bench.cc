@@ -0,0 +1,249 @@
+//
+//  info-elements-bench.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "AllocStats.h"
+
+#include "refract/Element.h"
+#include "refract/InfoElements.h"
+
+using namespace drafter;
+using namespace refract;
+
+namespace
+{
+    ///
+    /// Meta/attributes container as it was before InfoElements stored
+    /// entries inline: vector of string keyed pairs searched by string
+    /// comparison
+    ///
+    class VectorInfoElements
+    {
+        using Container = std::vector<std::pair<std::string, std::unique_ptr<IElement> > >;
+        Container elements;
+
+    public:
+        VectorInfoElements() = default;
+        VectorInfoElements(VectorInfoElements&&) = default;
+
+        VectorInfoElements(const VectorInfoElements& other)
+        {
+            elements.reserve(other.elements.size());
+            for (const auto& el : other.elements)
+                elements.emplace_back(el.first, el.second->clone());
+        }
+
+        Container::const_iterator end() const noexcept
+        {
+            return elements.end();
+        }
+
+        Container::const_iterator find(const std::string& name) const
+        {
+            return std::find_if(
+                elements.begin(), elements.end(), [&name](const auto& keyValue) { return keyValue.first == name; });
+        }
+
+        void set(const std::string& key, std::unique_ptr<IElement> value)
+        {
+            auto it = std::find_if(
+                elements.begin(), elements.end(), [&key](const auto& keyValue) { return keyValue.first == key; });
+
+            if (it == elements.end())
+                elements.emplace_back(key, std::move(value));
+            else
+                it->second = std::move(value);
+        }
+    };
+
+    // keys typical for meta and attributes of MSON elements
+    const std::string StringKeys[] = {
+        "id", "typeAttributes", "description", "default", "samples", "enumerations", "sourceMap", "title"
+    };
+
+    const Symbol SymbolKeys[] = {
+        sym::id, sym::typeAttributes, sym::description, sym::default_, sym::samples, sym::enumerations, sym::sourceMap,
+        sym::title
+    };
+
+    const size_t KeyCount = sizeof(StringKeys) / sizeof(StringKeys[0]);
+
+    const std::string MissingString = "nullable";
+    const Symbol MissingSymbol = sym::nullable;
+
+    template <typename Container>
+    struct Keys;
+
+    template <>
+    struct Keys<VectorInfoElements> {
+        static const std::string& at(size_t i)
+        {
+            return StringKeys[i];
+        }
+
+        static const std::string& missing()
+        {
+            return MissingString;
+        }
+    };
+
+    template <>
+    struct Keys<InfoElements> {
+        static Symbol at(size_t i)
+        {
+            return SymbolKeys[i];
+        }
+
+        static Symbol missing()
+        {
+            return MissingSymbol;
+        }
+    };
+
+    struct Result {
+        double nanoseconds = 0;
+        size_t allocations = 0;
+    };
+
+    volatile size_t sink = 0;
+
+    template <typename Operation>
+    Result Measure(size_t iterations, Operation operation)
+    {
+        AllocScope alloc;
+        auto start = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < iterations; ++i)
+            operation();
+
+        auto end = std::chrono::steady_clock::now();
+
+        Result result;
+        result.nanoseconds = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+        result.allocations = alloc.get().allocations / iterations;
+
+        return result;
+    }
+
+    template <typename Container>
+    Container Filled(size_t entries)
+    {
+        Container c;
+        for (size_t i = 0; i < entries; ++i)
+            c.set(Keys<Container>::at(i), from_primitive(true));
+        return c;
+    }
+
+    /// create, fill and destroy
+    template <typename Container>
+    Result Build(size_t entries, size_t iterations)
+    {
+        return Measure(iterations, [entries]() {
+            Container c = Filled<Container>(entries);
+            sink = sink + (c.find(Keys<Container>::at(0)) != c.end());
+        });
+    }
+
+    /// look up every entry and one missing key
+    template <typename Container>
+    Result Find(size_t entries, size_t iterations)
+    {
+        const Container c = Filled<Container>(entries);
+
+        return Measure(iterations, [&c, entries]() {
+            size_t found = 0;
+            for (size_t i = 0; i < entries; ++i)
+                found += c.find(Keys<Container>::at(i)) != c.end();
+            found += c.find(Keys<Container>::missing()) != c.end();
+            sink = sink + found;
+        });
+    }
+
+    /// deep copy
+    template <typename Container>
+    Result Copy(size_t entries, size_t iterations)
+    {
+        const Container c = Filled<Container>(entries);
+
+        return Measure(iterations, [&c]() {
+            Container copy(c);
+            sink = sink + (copy.find(Keys<Container>::missing()) != copy.end());
+        });
+    }
+
+    void Report(const char* operation, size_t entries, const Result& vector, const Result& info)
+    {
+        std::cout << std::left << std::setw(10) << operation << std::right << std::setw(8) << entries << std::fixed
+                  << std::setprecision(1) << std::setw(14) << vector.nanoseconds << std::setw(14) << info.nanoseconds
+                  << std::setw(10) << (info.nanoseconds > 0 ? vector.nanoseconds / info.nanoseconds : 0);
+
+        if (AllocStatsEnabled())
+            std::cout << std::setw(12) << vector.allocations << std::setw(12) << info.allocations;
+
+        std::cout << "\n";
+    }
+
+    template <Result (*VectorOp)(size_t, size_t), Result (*InfoOp)(size_t, size_t)>
+    void Run(const char* operation, size_t iterations)
+    {
+        for (size_t entries : { 0, 1, 2, 3, 4, 8 }) {
+            Result vector = VectorOp(entries, iterations);
+            Result info = InfoOp(entries, iterations);
+            Report(operation, entries, vector, info);
+        }
+    }
+
+    void help()
+    {
+        std::cout << "usage: info-elements-bench [-n <iterations>]\n\n";
+        std::cout << "Compares InfoElements with vector of string keyed entries it replaced.\n";
+        std::cout << "Reports ns per operation, allocations per operation in DRAFTER_ALLOC_STATS builds.\n";
+        std::cout << "Element values are created by both containers alike and are part of the cost\n";
+        std::cout << "of build and copy.\n";
+        exit(EXIT_SUCCESS);
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    size_t iterations = 200000;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+
+        if (arg == "-n" && i + 1 < argc)
+            iterations = std::max(1, std::atoi(argv[++i]));
+        else
+            help();
+    }
+
+    std::cout << "sizeof: vector " << sizeof(VectorInfoElements) << " B, InfoElements " << sizeof(InfoElements)
+              << " B\n\n";
+
+    std::cout << std::left << std::setw(10) << "operation" << std::right << std::setw(8) << "entries" << std::setw(14)
+              << "vector ns" << std::setw(14) << "info ns" << std::setw(10) << "speedup";
+
+    if (AllocStatsEnabled())
+        std::cout << std::setw(12) << "vec allocs" << std::setw(12) << "info allocs";
+
+    std::cout << "\n";
+
+    Run<Build<VectorInfoElements>, Build<InfoElements> >("build", iterations);
+    Run<Find<VectorInfoElements>, Find<InfoElements> >("find", iterations);
+    Run<Copy<VectorInfoElements>, Copy<InfoElements> >("copy", iterations);
+
+    return EXIT_SUCCESS;
+}
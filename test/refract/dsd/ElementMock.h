@@ -64,8 +64,8 @@ namespace refract
             }
 
             mutable int element_ctx = 0;
-            std::string element_out;
-            std::string element() const override
+            refract::Symbol element_out;
+            refract::Symbol element() const noexcept override
             {
                 ++_total_ctx;
                 ++element_ctx;
@@ -73,14 +73,23 @@ namespace refract
             }
 
             mutable int element_set_ctx = 0;
-            std::string element_set_in = {};
-            void element(const std::string& in) override
+            refract::Symbol element_set_in = {};
+            void element(refract::Symbol in) override
             {
                 ++_total_ctx;
                 ++element_set_ctx;
                 element_set_in = in;
             }
 
+            mutable int kind_ctx = 0;
+            refract::ElementKind kind_out = refract::ElementKind::Unknown;
+            refract::ElementKind kind() const noexcept override
+            {
+                ++_total_ctx;
+                ++kind_ctx;
+                return kind_out;
+            }
+
             mutable int content_ctx = 0;
             mutable refract::Visitor* content_in = nullptr;
             void content(refract::Visitor& v) const override
@@ -202,3 +202,56 @@ SCENARIO("Elements can be cloned with refract::clone(const IElement&)", "[Elemen
         }
     }
 }
+
+SCENARIO("Elements are downcast by their kind", "[Element]")
+{
+    static_assert(ObjectElement::Kind == ElementKind::Object, "");
+    static_assert(SourceMapElement::Kind == ElementKind::SourceMap, "");
+
+    GIVEN("a string element named after a user type")
+    {
+        std::unique_ptr<IElement> element = from_primitive("foo");
+        element->element("MyString");
+
+        THEN("its kind is String")
+        {
+            REQUIRE(element->kind() == ElementKind::String);
+        }
+
+        THEN("it can be cast to StringElement")
+        {
+            StringElement* str = dyn_cast<StringElement>(element.get());
+            REQUIRE(str == element.get());
+
+            const IElement* constElement = element.get();
+            REQUIRE(dyn_cast<const StringElement>(constElement) == str);
+        }
+
+        THEN("it can not be cast to other Element types")
+        {
+            REQUIRE(dyn_cast<NumberElement>(element.get()) == nullptr);
+            REQUIRE(dyn_cast<ObjectElement>(element.get()) == nullptr);
+        }
+    }
+
+    GIVEN("nullptr")
+    {
+        IElement* element = nullptr;
+
+        THEN("it is cast to nullptr")
+        {
+            REQUIRE(dyn_cast<StringElement>(element) == nullptr);
+        }
+    }
+
+    GIVEN("an IElement implemented outside of Element")
+    {
+        test::ElementMock mock;
+
+        THEN("it can not be cast to any Element type")
+        {
+            REQUIRE(dyn_cast<NullElement>(&mock) == nullptr);
+            REQUIRE(mock.kind_ctx == 1);
+        }
+    }
+}
@@ -656,14 +656,14 @@ SCENARIO("Extend::merge behaves as expected", "[Element][Extend][merge]")
         Extend extend;
 
         auto first = make_element<ArrayElement>();
-        first->get().push_back(make_element<StringElement>("foo"));
-        first->get().push_back(make_element<StringElement>("bar"));
-        first->get().push_back(make_element<StringElement>("baz"));
+        first->mutate().push_back(make_element<StringElement>("foo"));
+        first->mutate().push_back(make_element<StringElement>("bar"));
+        first->mutate().push_back(make_element<StringElement>("baz"));
         extend.insert(extend.end(), std::move(first));
 
         auto last = make_element<ArrayElement>();
-        last->get().push_back(make_element<StringElement>("zur"));
-        last->get().push_back(make_element<NumberElement>(42));
+        last->mutate().push_back(make_element<StringElement>("zur"));
+        last->mutate().push_back(make_element<NumberElement>(42));
         extend.insert(extend.end(), std::move(last));
 
         WHEN("it is merged")
@@ -710,9 +710,9 @@ SCENARIO("Extend::merge behaves as expected", "[Element][Extend][merge]")
                 make_element<StringElement>("zul")));
 
         auto extend = make_element<ExtendElement>();
-        extend->get().push_back(std::move(first));
-        extend->get().push_back(std::move(second));
-        extend->get().push_back(std::move(third));
+        extend->mutate().push_back(std::move(first));
+        extend->mutate().push_back(std::move(second));
+        extend->mutate().push_back(std::move(third));
 
         WHEN("it is merged")
         {
@@ -216,3 +216,72 @@ SCENARIO("InfoElementss can be copied and moved", "[InfoElements]")
         }
     }
 }
+
+SCENARIO("InfoElements grow beyond inline capacity", "[InfoElements]")
+{
+    GIVEN("An InfoElements with more entries than fit inline")
+    {
+        const size_t count = InfoElements::InlineCapacity * 3 + 1;
+
+        InfoElements collection;
+        std::vector<IElement*> mocks;
+
+        for (size_t i = 0; i < count; ++i) {
+            mocks.push_back(new test::ElementMock{});
+            collection.set(Symbol("key" + std::to_string(i)), std::unique_ptr<IElement>(mocks.back()));
+        }
+
+        THEN("all entries are kept in insertion order")
+        {
+            REQUIRE(collection.size() == count);
+
+            size_t i = 0;
+            for (const auto& m : collection) {
+                REQUIRE(m.first == "key" + std::to_string(i));
+                REQUIRE(m.second.get() == mocks[i]);
+                ++i;
+            }
+        }
+
+        WHEN("an entry from the middle is claimed")
+        {
+            auto claimed = collection.claim(Symbol("key1"));
+
+            THEN("the remaining entries keep their order")
+            {
+                REQUIRE(claimed.get() == mocks[1]);
+                REQUIRE(collection.size() == count - 1);
+                REQUIRE(collection.find(Symbol("key1")) == collection.end());
+                REQUIRE((collection.begin() + 1)->second.get() == mocks[2]);
+            }
+        }
+
+        WHEN("it is swapped with an InfoElements using inline storage")
+        {
+            InfoElements small;
+            auto mock = new test::ElementMock{};
+            small.set(Symbol("id"), std::unique_ptr<IElement>(mock));
+
+            swap(collection, small);
+
+            THEN("their entries are exchanged")
+            {
+                REQUIRE(collection.size() == 1);
+                REQUIRE(collection.find(Symbol("id"))->second.get() == mock);
+                REQUIRE(small.size() == count);
+                REQUIRE(small.find(Symbol("key0"))->second.get() == mocks[0]);
+            }
+        }
+
+        WHEN("it is cleared")
+        {
+            collection.clear();
+
+            THEN("all entries are destructed")
+            {
+                REQUIRE(collection.empty());
+                REQUIRE(test::ElementMock::instances().size() == 0);
+            }
+        }
+    }
+}
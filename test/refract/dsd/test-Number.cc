@@ -8,6 +8,10 @@
 
 #include <catch2/catch.hpp>
 
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
 #include "refract/dsd/Number.h"
 
 using namespace refract;
@@ -150,3 +154,78 @@ SCENARIO("number DSDs are tested for equality and inequality", "[Element][Number
         }
     }
 }
+
+SCENARIO("Number keeps integers parsed and other values verbatim", "[ElementData][Number]")
+{
+    GIVEN("A Number constructed from an integer")
+    {
+        Number number(std::size_t{ 1234 });
+
+        THEN("it is an integer")
+        {
+            REQUIRE(number.isInteger());
+            REQUIRE(static_cast<std::int64_t>(number) == 1234);
+            REQUIRE(static_cast<double>(number) == 1234.0);
+        }
+
+        THEN("it equals the Number parsed from its text")
+        {
+            REQUIRE(number == Number("1234"));
+            REQUIRE(number.get() == "1234");
+        }
+    }
+
+    GIVEN("Numbers parsed from canonical integers")
+    {
+        THEN("they are integers rendered as given")
+        {
+            for (const char* text : { "0", "-17", "9223372036854775807", "-9223372036854775808" }) {
+                Number number(text);
+                REQUIRE(number.isInteger());
+                REQUIRE(number.get() == text);
+            }
+        }
+    }
+
+    GIVEN("Numbers parsed from other texts")
+    {
+        THEN("they keep their original text")
+        {
+            for (const char* text : { "-0", "1.0", "1e3", "0.10", "007", "9223372036854775808" }) {
+                Number number(text);
+                REQUIRE(!number.isInteger());
+                REQUIRE(number.get() == text);
+            }
+        }
+
+        THEN("their value is parsed")
+        {
+            REQUIRE(static_cast<double>(Number("1e3")) == 1000.0);
+            REQUIRE(static_cast<double>(Number("-2.5")) == -2.5);
+            REQUIRE(static_cast<std::int64_t>(Number("42.7")) == 42);
+        }
+
+        THEN("they are not equal to the integer of the same value")
+        {
+            REQUIRE(Number("1.0") != Number(1));
+        }
+    }
+
+    GIVEN("A Number constructed from an unsigned integer out of int64 range")
+    {
+        Number number(std::numeric_limits<std::uint64_t>::max());
+
+        THEN("only construction from unsigned integers may throw")
+        {
+            REQUIRE(std::is_nothrow_constructible<Number, std::int64_t>::value);
+            REQUIRE_FALSE(std::is_nothrow_constructible<Number, std::uint64_t>::value);
+        }
+
+        THEN("it is rendered losslessly")
+        {
+            REQUIRE(!number.isInteger());
+            REQUIRE(number.get() == "18446744073709551615");
+            REQUIRE(number == Number("18446744073709551615"));
+        }
+    }
+}
@@ -215,11 +215,12 @@ SCENARIO("`Object` is inserted to and erased from", "[ElementData][Object]")
                     REQUIRE(object.begin()[1].get() == mock2ptr);
                 }
 
-                THEN("the second mock was visited to check whether it is a property equal to the first")
+                THEN("the kind of the second mock was queried to check whether it is a property equal to the first")
                 {
                     REQUIRE(mock1ptr->_total_ctx == 0);
                     REQUIRE(mock2ptr->_total_ctx == 1);
-                    REQUIRE(mock2ptr->content_ctx == 1);
+                    REQUIRE(mock2ptr->kind_ctx == 1);
+                    REQUIRE(mock2ptr->content_ctx == 0);
                 }
 
                 THEN("there still are just two mock instances")
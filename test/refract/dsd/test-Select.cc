@@ -426,7 +426,7 @@ SCENARIO("`Select` is move-constructed from elements", "[ElementData][Select]")
 
                     THEN("it is iterable")
                     {
-                        auto mocks = std::array<IElement*, 3>{ mock1clone, mock2clone, mock3clone };
+                        auto mocks = std::array<IElement*, 3>{ mock1ptr, mock2ptr, mock3ptr };
                         auto mocks_it = mocks.begin();
                         int ctx = 0;
                         for (const auto& el : select2) {
@@ -444,8 +444,25 @@ SCENARIO("`Select` is move-constructed from elements", "[ElementData][Select]")
                         REQUIRE(test::ElementMock::instances().size() == 6);
                     }
 
-                    THEN("its members were obtained calling `IElement::clone(cAll)` on original mocks")
+                    THEN("its members share the original mocks until they are modified")
                     {
+                        auto first = [](const OptionElement& option) { return option.get().begin()[0].get(); };
+
+                        REQUIRE(first(*select2.begin()[0]) == mock1ptr);
+                        REQUIRE(first(*select2.begin()[1]) == mock2ptr);
+                        REQUIRE(first(*select2.begin()[2]) == mock3ptr);
+
+                        REQUIRE(mock1ptr->_total_ctx == 0);
+                        REQUIRE(mock2ptr->_total_ctx == 0);
+                        REQUIRE(mock3ptr->_total_ctx == 0);
+                    }
+
+                    THEN("its members were obtained calling `IElement::clone(cAll)` on original mocks once modified")
+                    {
+                        REQUIRE(select2.begin()[0]->mutate().begin()[0].get() == mock1clone);
+                        REQUIRE(select2.begin()[1]->mutate().begin()[0].get() == mock2clone);
+                        REQUIRE(select2.begin()[2]->mutate().begin()[0].get() == mock3clone);
+
                         REQUIRE(mock1ptr->_total_ctx == 1);
                         REQUIRE(mock2ptr->_total_ctx == 1);
                         REQUIRE(mock3ptr->_total_ctx == 1);
@@ -457,10 +474,6 @@ SCENARIO("`Select` is move-constructed from elements", "[ElementData][Select]")
                         REQUIRE(mock1ptr->clone_in == IElement::cAll);
                         REQUIRE(mock2ptr->clone_in == IElement::cAll);
                         REQUIRE(mock3ptr->clone_in == IElement::cAll);
-
-                        REQUIRE(select2.begin()[0]->get().begin()[0].get() == mock1clone);
-                        REQUIRE(select2.begin()[1]->get().begin()[0].get() == mock2clone);
-                        REQUIRE(select2.begin()[2]->get().begin()[0].get() == mock3clone);
                     }
                 }
 
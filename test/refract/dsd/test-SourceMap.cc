@@ -0,0 +1,120 @@
+//
+//  test/refract/dsd/test-SourceMap.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/Element.h"
+#include "refract/SerializeSo.h"
+#include "utils/so/JsonIo.h"
+#include "utils/so/YamlIo.h"
+
+#include <sstream>
+
+using namespace refract;
+using namespace dsd;
+using namespace drafter::utils;
+
+namespace
+{
+    std::string to_json(const IElement& e)
+    {
+        std::ostringstream ss{};
+        so::serialize_json(ss, serialize::renderSo(e, true));
+        return ss.str();
+    }
+
+    std::string to_yaml(const IElement& e)
+    {
+        std::ostringstream ss{};
+        so::serialize_yaml(ss, serialize::renderSo(e, true));
+        return ss.str();
+    }
+
+    // source map built of generic Elements, the way it used to be
+    std::unique_ptr<IElement> sourceMapOfElements()
+    {
+        auto ranges = make_element<ArrayElement>( //
+            make_element<ArrayElement>(from_primitive(size_t{ 3 }), from_primitive(size_t{ 14 })),
+            make_element<ArrayElement>(from_primitive(size_t{ 20 }), from_primitive(size_t{ 5 })));
+        ranges->element("sourceMap");
+
+        auto element = from_primitive("value");
+        element->attributes().set("sourceMap", make_element<ArrayElement>(std::move(ranges)));
+        return std::move(element);
+    }
+
+    std::unique_ptr<IElement> sourceMapOfRanges()
+    {
+        auto element = from_primitive("value");
+        element->attributes().set(
+            "sourceMap", make_element<ArrayElement>(make_element<SourceMapElement>(SourceMap::Ranges{ 3, 14, 20, 5 })));
+        return std::move(element);
+    }
+}
+
+TEST_CASE("`SourceMap`'s default element name is `sourceMap`", "[Element][SourceMap]")
+{
+    REQUIRE(std::string(SourceMap::name) == "sourceMap");
+}
+
+SCENARIO("`SourceMap` stores ranges as location and length pairs", "[ElementData][SourceMap]")
+{
+    GIVEN("A default initialized SourceMap")
+    {
+        SourceMap sourceMap;
+
+        THEN("it has no ranges")
+        {
+            REQUIRE(sourceMap.rangeCount() == 0);
+            REQUIRE(sourceMap.ranges().empty());
+        }
+
+        WHEN("two ranges are added")
+        {
+            sourceMap.addRange(3, 14);
+            sourceMap.addRange(20, 5);
+
+            THEN("it has two ranges")
+            {
+                REQUIRE(sourceMap.rangeCount() == 2);
+                REQUIRE(sourceMap.location(0) == 3);
+                REQUIRE(sourceMap.length(0) == 14);
+                REQUIRE(sourceMap.location(1) == 20);
+                REQUIRE(sourceMap.length(1) == 5);
+            }
+
+            THEN("it equals SourceMap constructed from the same pairs")
+            {
+                REQUIRE(sourceMap == SourceMap({ 3, 14, 20, 5 }));
+            }
+
+            THEN("it differs from SourceMap with other ranges")
+            {
+                REQUIRE(!(sourceMap == SourceMap({ 3, 14 })));
+            }
+        }
+    }
+}
+
+SCENARIO("`SourceMapElement` is serialized as source map made of Array and Number Elements", "[SourceMap][serialize]")
+{
+    GIVEN("an element with source map stored as SourceMap and another with source map of Elements")
+    {
+        auto compact = sourceMapOfRanges();
+        auto generic = sourceMapOfElements();
+
+        THEN("their JSON serializations are the same")
+        {
+            REQUIRE(to_json(*compact) == to_json(*generic));
+        }
+
+        THEN("their YAML serializations are the same")
+        {
+            REQUIRE(to_yaml(*compact) == to_yaml(*generic));
+        }
+    }
+}
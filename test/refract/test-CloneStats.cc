@@ -0,0 +1,99 @@
+//
+//  test/refract/test-CloneStats.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/CloneStats.h"
+#include "refract/Element.h"
+
+using namespace refract;
+
+SCENARIO("CloneScope counts copies of Elements made by current thread", "[Element][clones]")
+{
+    GIVEN("an array element with two members")
+    {
+        auto array = make_element<ArrayElement>(from_primitive("value"), from_primitive(42));
+
+        WHEN("nothing is copied")
+        {
+            CloneScope scope;
+            array->mutate().push_back(from_primitive(true));
+
+            THEN("no copies are counted")
+            {
+                REQUIRE(scope.get().elements == 0);
+                REQUIRE(scope.get().data == 0);
+            }
+        }
+
+        WHEN("it is cloned")
+        {
+            CloneScope scope;
+            auto copy = array->clone();
+
+            THEN("one element clone is counted")
+            {
+                REQUIRE(scope.get().elements == 1);
+            }
+
+            THEN("its content is not copied")
+            {
+                REQUIRE(scope.get().data == 0);
+            }
+
+            AND_WHEN("the clone is read")
+            {
+                auto& mutableCopy = static_cast<ArrayElement&>(*copy);
+                REQUIRE(mutableCopy.get().size() == 2);
+
+                THEN("its content is not copied")
+                {
+                    REQUIRE(scope.get().data == 0);
+                    REQUIRE(scope.get().elements == 1);
+                }
+            }
+
+            AND_WHEN("the clone is modified")
+            {
+                static_cast<ArrayElement&>(*copy).mutate().push_back(from_primitive(true));
+
+                THEN("the content is copied once")
+                {
+                    REQUIRE(scope.get().data == 1);
+                }
+
+                THEN("members of the copied content are cloned")
+                {
+                    REQUIRE(scope.get().elements == 3);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("CloneScopes nest", "[Element][clones]")
+{
+    auto element = from_primitive("value");
+
+    CloneScope outer;
+    element->clone();
+
+    {
+        CloneScope inner;
+        element->clone();
+
+        REQUIRE(inner.get().elements == 1);
+    }
+
+    REQUIRE(outer.get().elements == 2);
+
+    CloneStats total;
+    total += outer.get();
+    total += outer.get();
+
+    REQUIRE(total.elements == 4);
+}
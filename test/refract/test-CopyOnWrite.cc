@@ -0,0 +1,83 @@
+//
+//  test/refract/test-CopyOnWrite.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/Element.h"
+
+using namespace refract;
+
+static_assert(dsd::has_children<dsd::Array>::value, "");
+static_assert(dsd::has_children<dsd::Object>::value, "");
+static_assert(dsd::has_children<dsd::Member>::value, "");
+static_assert(dsd::has_children<dsd::Ref>::value == false, "");
+static_assert(dsd::has_children<dsd::String>::value == false, "");
+static_assert(dsd::has_children<dsd::Number>::value == false, "");
+
+SCENARIO("Clones of an Element share its subtree until modified", "[Element][cow]")
+{
+    GIVEN("an array element with a nested object")
+    {
+        auto object = make_element<ObjectElement>(make_element<MemberElement>("key", from_primitive("value")));
+        auto array = make_element<ArrayElement>(std::move(object), from_primitive(42));
+
+        const IElement* nested = array->get().begin()->get();
+
+        WHEN("it is cloned")
+        {
+            auto copy = array->clone();
+            const auto& constCopy = static_cast<const ArrayElement&>(*copy);
+
+            THEN("the clone refers to the same nested elements")
+            {
+                REQUIRE(constCopy.get().begin()->get() == nested);
+            }
+
+            THEN("the clone is equal to the original")
+            {
+                REQUIRE(*copy == *array);
+            }
+
+            THEN("modifying the clone leaves the original untouched")
+            {
+                auto& mutableCopy = static_cast<ArrayElement&>(*copy);
+                mutableCopy.mutate().push_back(from_primitive(true));
+
+                REQUIRE(mutableCopy.get().size() == 3);
+                REQUIRE(array->get().size() == 2);
+                REQUIRE(mutableCopy.get().begin()->get() != nested);
+            }
+
+            THEN("modifying the original leaves the clone untouched")
+            {
+                array->mutate().clear();
+
+                REQUIRE(array->get().empty());
+                REQUIRE(constCopy.get().size() == 2);
+                REQUIRE(constCopy.get().begin()->get() == nested);
+            }
+
+            THEN("the clone outlives the original")
+            {
+                array.reset();
+
+                REQUIRE(constCopy.get().size() == 2);
+                REQUIRE(constCopy.get().begin()->get() == nested);
+            }
+        }
+
+        WHEN("it is cloned without its value")
+        {
+            auto copy = array->clone(IElement::cAll ^ IElement::cValue);
+
+            THEN("the clone is empty")
+            {
+                REQUIRE(copy->empty());
+            }
+        }
+    }
+}
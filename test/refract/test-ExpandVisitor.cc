@@ -0,0 +1,199 @@
+//
+//  test/refract/test-ExpandVisitor.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/Element.h"
+#include "refract/Exception.h"
+#include "refract/ExpandVisitor.h"
+#include "refract/Registry.h"
+
+#include "SourceAnnotation.h"
+
+using namespace refract;
+
+namespace
+{
+    template <typename... Members>
+    std::unique_ptr<IElement> namedType(const char* name, const char* base, Members... members)
+    {
+        auto e = make_element<ObjectElement>(std::move(members)...);
+        e->element(base);
+        e->meta().set(sym::id, from_primitive(std::string(name)));
+        return std::move(e);
+    }
+
+    std::unique_ptr<IElement> memberOfType(const char* key, const char* type)
+    {
+        auto value = make_empty<ObjectElement>();
+        value->element(type);
+        return make_element<MemberElement>(key, std::move(value));
+    }
+
+    std::unique_ptr<IElement> expand(
+        const IElement& e, const Registry& registry, ExpansionCache* cache, std::size_t limit = 0)
+    {
+        ExpandVisitor expander(registry, cache, limit);
+        Visit(expander, e);
+        return expander.get();
+    }
+}
+
+SCENARIO("Named types are expanded once per ExpansionCache", "[Element][expand]")
+{
+    GIVEN("a registry with an inherited named type")
+    {
+        Registry registry;
+        registry.add(namedType("Base", "object", make_element<MemberElement>("a", from_primitive("A"))));
+        registry.add(namedType("Derived", "Base", make_element<MemberElement>("b", from_primitive("B"))));
+
+        auto object = make_element<ObjectElement>(
+            memberOfType("x", "Derived"),
+            memberOfType("y", "Derived"),
+            memberOfType("z", "Base"),
+            make_element<RefElement>("Derived"));
+
+        const auto uncached = expand(*object, registry, nullptr);
+        REQUIRE(uncached);
+
+        WHEN("an element referencing the types repeatedly is expanded with a cache")
+        {
+            ExpansionCache cache;
+            const auto cached = expand(*object, registry, &cache);
+
+            THEN("the result is the same as without the cache")
+            {
+                REQUIRE(*cached == *uncached);
+            }
+
+            THEN("every named type is stored once")
+            {
+                REQUIRE(cache.inherited.size() == 2);
+                REQUIRE(cache.inherited.count("Base") == 1);
+                REQUIRE(cache.inherited.count("Derived") == 1);
+            }
+
+            THEN("the mixin is stored")
+            {
+                REQUIRE(cache.resolved.size() == 1);
+                REQUIRE(cache.resolved.count("Derived") == 1);
+            }
+
+            AND_WHEN("it is expanded again")
+            {
+                const auto again = expand(*object, registry, &cache);
+
+                THEN("the result is the same as without the cache")
+                {
+                    REQUIRE(*again == *uncached);
+                }
+            }
+        }
+    }
+
+    GIVEN("a registry with mutually referencing named types")
+    {
+        Registry registry;
+        registry.add(namedType("A", "object", memberOfType("b", "B")));
+        registry.add(namedType("B", "object", memberOfType("a", "A")));
+
+        auto typeA = make_empty<ObjectElement>();
+        typeA->element("A");
+
+        auto typeB = make_empty<ObjectElement>();
+        typeB->element("B");
+
+        WHEN("an element of the first type is expanded with a cache")
+        {
+            ExpansionCache cache;
+            const auto cached = expand(*typeA, registry, &cache);
+
+            THEN("the result is the same as without the cache")
+            {
+                REQUIRE(*cached == *expand(*typeA, registry, nullptr));
+            }
+
+            THEN("the type cut short by the circular reference is not stored")
+            {
+                REQUIRE(cache.inherited.count("A") == 1);
+                REQUIRE(cache.inherited.count("B") == 0);
+            }
+
+            AND_WHEN("an element of the second type is expanded")
+            {
+                const auto cachedB = expand(*typeB, registry, &cache);
+
+                THEN("it is the same as without the cache")
+                {
+                    REQUIRE(*cachedB == *expand(*typeB, registry, nullptr));
+                    REQUIRE(cache.inherited.count("B") == 1);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Expansion is bounded", "[Element][expand]")
+{
+    GIVEN("named types using the previous one twice")
+    {
+        // expansion of T(i) contains 2^i copies of T0
+        Registry registry;
+        registry.add(namedType("T0", "object", make_element<MemberElement>("x", from_primitive("X"))));
+
+        for (int i = 1; i <= 40; ++i) {
+            const std::string name = "T" + std::to_string(i);
+            const std::string previous = "T" + std::to_string(i - 1);
+            registry.add(namedType(
+                name.c_str(), "object", memberOfType("a", previous.c_str()), memberOfType("b", previous.c_str())));
+        }
+
+        registry.freeze();
+
+        auto small = make_empty<ObjectElement>();
+        small->element("T4");
+
+        auto huge = make_empty<ObjectElement>();
+        huge->element("T40");
+
+        WHEN("a small type is expanded with a limit")
+        {
+            ExpansionCache cache;
+            const auto limited = expand(*small, registry, &cache, 10000);
+
+            THEN("it is the same as without the limit")
+            {
+                REQUIRE(*limited == *expand(*small, registry, nullptr));
+            }
+        }
+
+        WHEN("a type with exponential expansion is expanded with a limit")
+        {
+            THEN("the limit is reported")
+            {
+                ExpansionCache cache;
+                REQUIRE_THROWS_AS(expand(*huge, registry, &cache, 10000), ExpansionLimitExceeded);
+                REQUIRE_THROWS_AS(expand(*huge, registry, nullptr, 10000), ExpansionLimitExceeded);
+            }
+        }
+    }
+
+    GIVEN("an unfrozen registry with circular inheritance")
+    {
+        Registry registry;
+        registry.add(namedType("A", "B"));
+        registry.add(namedType("B", "A"));
+
+        auto typeA = make_empty<ObjectElement>();
+        typeA->element("A");
+
+        THEN("expansion reports it")
+        {
+            REQUIRE_THROWS_AS(expand(*typeA, registry, nullptr), snowcrash::Error);
+        }
+    }
+}
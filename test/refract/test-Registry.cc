@@ -0,0 +1,107 @@
+//
+//  test/refract/test-Registry.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/Element.h"
+#include "refract/Exception.h"
+#include "refract/Registry.h"
+
+using namespace refract;
+
+namespace
+{
+    std::unique_ptr<IElement> namedType(const char* name, const char* base)
+    {
+        auto e = make_empty<ObjectElement>();
+        e->element(base);
+        e->meta().set(sym::id, from_primitive(std::string(name)));
+        return std::move(e);
+    }
+}
+
+SCENARIO("Frozen Registry resolves inheritance of named types", "[Element][registry]")
+{
+    GIVEN("a registry with an inheritance chain")
+    {
+        Registry registry;
+        REQUIRE(registry.add(namedType("C", "B")));
+        REQUIRE(registry.add(namedType("B", "A")));
+        REQUIRE(registry.add(namedType("A", "object")));
+        REQUIRE(registry.add(namedType("D", "Unknown")));
+
+        const IElement* a = registry.find("A");
+        const IElement* d = registry.find("D");
+
+        THEN("root ancestors are found before it is frozen")
+        {
+            REQUIRE_FALSE(registry.frozen());
+            REQUIRE(FindRootAncestor("C", registry) == a);
+            REQUIRE(FindRootAncestor("D", registry) == d);
+        }
+
+        WHEN("it is frozen")
+        {
+            registry.freeze();
+
+            THEN("every named type knows its root ancestor")
+            {
+                REQUIRE(FindRootAncestor("A", registry) == a);
+                REQUIRE(FindRootAncestor("B", registry) == a);
+                REQUIRE(FindRootAncestor("C", registry) == a);
+                REQUIRE(FindRootAncestor("D", registry) == d);
+                REQUIRE(FindRootAncestor("E", registry) == nullptr);
+            }
+
+            THEN("the inheritance chain is linked")
+            {
+                const Registry::Type* type = registry.findType("C");
+                REQUIRE(type);
+
+                std::vector<std::string> chain;
+                for (; type; type = registry.findParent(*type))
+                    chain.push_back(type->name);
+
+                REQUIRE(chain == std::vector<std::string>{ "C", "B", "A" });
+            }
+
+            THEN("it can not be changed")
+            {
+                REQUIRE_THROWS_AS(registry.add(namedType("E", "object")), LogicError);
+                REQUIRE_THROWS_AS(registry.remove("A"), LogicError);
+            }
+
+            AND_WHEN("it is cleared")
+            {
+                registry.clearAll();
+
+                THEN("named types can be added again")
+                {
+                    REQUIRE_FALSE(registry.frozen());
+                    REQUIRE(registry.add(namedType("E", "object")));
+                }
+            }
+        }
+    }
+
+    GIVEN("a registry with circular inheritance")
+    {
+        Registry registry;
+        registry.add(namedType("A", "B"));
+        registry.add(namedType("B", "A"));
+
+        THEN("root ancestor lookup does not loop forever")
+        {
+            REQUIRE_THROWS_AS(FindRootAncestor("A", registry), LogicError);
+        }
+
+        THEN("it can not be frozen")
+        {
+            REQUIRE_THROWS_AS(registry.freeze(), LogicError);
+        }
+    }
+}
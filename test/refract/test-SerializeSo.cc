@@ -0,0 +1,126 @@
+//
+//  test/refract/test-SerializeSo.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/Element.h"
+#include "refract/SerializeSo.h"
+#include "utils/so/JsonIo.h"
+#include "utils/so/YamlIo.h"
+
+#include <sstream>
+
+using namespace refract;
+using namespace dsd;
+using namespace drafter::utils;
+
+namespace
+{
+    std::unique_ptr<IElement> withSourceMap(std::unique_ptr<IElement> element)
+    {
+        element->attributes().set(
+            "sourceMap", make_element<ArrayElement>(make_element<SourceMapElement>(SourceMap::Ranges{ 3, 14 })));
+        return element;
+    }
+
+    // every kind of content, empty containers, escaped strings and keys
+    std::unique_ptr<IElement> sample()
+    {
+        auto annotation = withSourceMap(from_primitive("line \"1\"\n"));
+        annotation->element("annotation");
+
+        auto root = make_element<ObjectElement>( //
+            make_element<MemberElement>("string", withSourceMap(from_primitive("text\t"))),
+            make_element<MemberElement>("number", from_primitive(42)),
+            make_element<MemberElement>("yes", from_primitive(true)),
+            make_element<MemberElement>("no", from_primitive(false)),
+            make_element<MemberElement>("null", make_element<NullElement>()),
+            make_element<MemberElement>("some key", make_element<RefElement>("Type")),
+            make_element<MemberElement>("enum", make_element<EnumElement>(from_primitive("a"))),
+            make_element<MemberElement>("select",
+                make_element<SelectElement>(make_element<OptionElement>(from_primitive(1), from_primitive("b")))),
+            make_element<MemberElement>("array", make_element<ArrayElement>(make_element<ArrayElement>())),
+            make_element<MemberElement>("object", make_element<ObjectElement>()),
+            make_element<MemberElement>("empty", make_empty<StringElement>()),
+            make_element<MemberElement>("annotation", std::move(annotation)));
+
+        root->meta().set("id", from_primitive("Sample"));
+        root->meta().set("sourceMap", make_element<SourceMapElement>(SourceMap::Ranges{ 1, 2 }));
+        return std::move(root);
+    }
+
+    std::string writtenJson(const IElement& e, bool sourceMaps)
+    {
+        std::ostringstream ss{};
+        serialize::renderJson(ss, e, sourceMaps);
+        return ss.str();
+    }
+
+    std::string printedJson(const IElement& e, bool sourceMaps)
+    {
+        std::ostringstream ss{};
+        so::serialize_json(ss, serialize::renderSo(e, sourceMaps));
+        return ss.str();
+    }
+
+    std::string writtenYaml(const IElement& e, bool sourceMaps)
+    {
+        std::ostringstream ss{};
+        serialize::renderYaml(ss, e, sourceMaps);
+        return ss.str();
+    }
+
+    std::string printedYaml(const IElement& e, bool sourceMaps)
+    {
+        std::ostringstream ss{};
+        so::serialize_yaml(ss, serialize::renderSo(e, sourceMaps));
+        return ss.str();
+    }
+}
+
+SCENARIO("API Elements are written as they are walked", "[serialize]")
+{
+    GIVEN("An element tree with every kind of content")
+    {
+        const auto tree = sample();
+
+        THEN("JSON written equals JSON printed from its Simple Object")
+        {
+            REQUIRE(writtenJson(*tree, false) == printedJson(*tree, false));
+            REQUIRE(writtenJson(*tree, true) == printedJson(*tree, true));
+        }
+
+        THEN("YAML written equals YAML printed from its Simple Object")
+        {
+            REQUIRE(writtenYaml(*tree, false) == printedYaml(*tree, false));
+            REQUIRE(writtenYaml(*tree, true) == printedYaml(*tree, true));
+        }
+
+        THEN("source maps are written only if asked for or on annotations")
+        {
+            const auto json = writtenJson(*tree, false);
+            REQUIRE(json.find("\"sourceMap\":") != std::string::npos);
+            REQUIRE(json.find("\"sourceMap\":") == json.rfind("\"sourceMap\":"));
+
+            const auto all = writtenJson(*tree, true);
+            REQUIRE(all.find("\"sourceMap\":") != all.rfind("\"sourceMap\":"));
+        }
+    }
+
+    GIVEN("An element with only source maps in its meta")
+    {
+        auto element = from_primitive("value");
+        element->meta().set("sourceMap", make_element<SourceMapElement>(SourceMap::Ranges{ 1, 2 }));
+
+        THEN("its meta is left out unless source maps are written")
+        {
+            REQUIRE(writtenJson(*element, false) == printedJson(*element, false));
+            REQUIRE(writtenJson(*element, false).find("\"meta\"") == std::string::npos);
+            REQUIRE(writtenYaml(*element, true) == printedYaml(*element, true));
+        }
+    }
+}
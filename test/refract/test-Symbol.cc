@@ -0,0 +1,232 @@
+//
+//  test/refract/test-Symbol.cc
+//  test-librefract
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "refract/Element.h"
+#include "refract/Symbol.h"
+
+#include <thread>
+#include <vector>
+
+using namespace refract;
+
+SCENARIO("Symbols of names which are not well known are reference counted", "[symbol]")
+{
+    GIVEN("a symbol created from a string never seen before")
+    {
+        const Symbol s("test-Symbol-unique-name");
+
+        THEN("the same string yields an equal symbol")
+        {
+            REQUIRE(s == Symbol(std::string("test-Symbol-unique-name")));
+            REQUIRE(std::hash<Symbol>()(s) == std::hash<Symbol>()(Symbol("test-Symbol-unique-name")));
+            REQUIRE(s.id() == Symbol::NotWellKnown);
+        }
+
+        THEN("it refers to the original string")
+        {
+            REQUIRE(s.str() == "test-Symbol-unique-name");
+            REQUIRE(s == "test-Symbol-unique-name");
+            REQUIRE(s != "test-Symbol");
+        }
+
+        THEN("a different string yields a different symbol")
+        {
+            REQUIRE(s != Symbol("test-Symbol-other-name"));
+            REQUIRE(Symbol("test-Symbol-other-name") < s);
+        }
+
+        THEN("its copies share the string")
+        {
+            const Symbol copy = s;
+            REQUIRE(copy.c_str() == s.c_str());
+        }
+
+        THEN("it is not found among well known symbols")
+        {
+            REQUIRE(Symbol::find("test-Symbol-unique-name").empty());
+        }
+    }
+
+    GIVEN("copies of a symbol released by several threads")
+    {
+        const size_t threadCount = 4;
+        std::vector<size_t> mismatches(threadCount, 0);
+        std::vector<std::thread> threads;
+
+        {
+            const Symbol s("test-Symbol-shared-name");
+
+            for (size_t t = 0; t < threadCount; ++t)
+                threads.emplace_back([s, t, &mismatches]() {
+                    for (int i = 0; i < 1000; ++i) {
+                        Symbol copy = s;
+                        if (copy != "test-Symbol-shared-name")
+                            ++mismatches[t];
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        THEN("every copy refers to the original string")
+        {
+            REQUIRE(mismatches == std::vector<size_t>(threadCount, 0));
+        }
+    }
+}
+
+SCENARIO("Names of a document are interned in its symbol table", "[symbol]")
+{
+    GIVEN("symbols created in a scope of a table")
+    {
+        SymbolTable table;
+        std::vector<Symbol> symbols;
+
+        {
+            SymbolScope scope(table);
+            symbols.emplace_back("test-Symbol-interned");
+            symbols.emplace_back(std::string("test-Symbol-interned"));
+            symbols.emplace_back("test-Symbol-interned-other");
+            symbols.emplace_back("string");
+        }
+
+        THEN("each name not well known is interned once")
+        {
+            REQUIRE(table.size() == 2);
+            REQUIRE(symbols[0].c_str() == symbols[1].c_str());
+            REQUIRE(symbols[3] == sym::string);
+        }
+
+        THEN("they are compared by identity")
+        {
+            REQUIRE(symbols[0] == symbols[1]);
+            REQUIRE(symbols[0] != symbols[2]);
+            REQUIRE(symbols[0] == "test-Symbol-interned");
+        }
+
+        THEN("they equal symbols of the same name out of the table")
+        {
+            REQUIRE(symbols[0] == Symbol("test-Symbol-interned"));
+            REQUIRE(Symbol("test-Symbol-interned") == symbols[0]);
+            REQUIRE(std::hash<Symbol>()(symbols[0]) == std::hash<Symbol>()(Symbol("test-Symbol-interned")));
+
+            SymbolTable other;
+            SymbolScope scope(other);
+            REQUIRE(symbols[0] == Symbol("test-Symbol-interned"));
+            REQUIRE(other.size() == 1);
+        }
+
+        THEN("copies of them share the name")
+        {
+            const Symbol copy = symbols[0];
+            REQUIRE(copy.c_str() == symbols[0].c_str());
+            REQUIRE(table.size() == 2);
+        }
+
+        THEN("names created out of the scope are not interned")
+        {
+            const Symbol s("test-Symbol-interned");
+            REQUIRE(s.c_str() != symbols[0].c_str());
+        }
+    }
+
+    GIVEN("nested scopes")
+    {
+        SymbolTable outer;
+        SymbolTable inner;
+
+        SymbolScope outerScope(outer);
+        {
+            SymbolScope innerScope(inner);
+            Symbol s("test-Symbol-nested");
+        }
+        Symbol s("test-Symbol-nested");
+
+        THEN("names are interned in the innermost table")
+        {
+            REQUIRE(inner.size() == 1);
+            REQUIRE(outer.size() == 1);
+        }
+    }
+
+    GIVEN("symbols of one name created by several threads in one table")
+    {
+        SymbolTable table;
+        const size_t threadCount = 4;
+        std::vector<Symbol> symbols(threadCount);
+        std::vector<std::thread> threads;
+
+        for (size_t t = 0; t < threadCount; ++t)
+            threads.emplace_back([&table, &symbols, t]() {
+                SymbolScope scope(table);
+                for (int i = 0; i < 100; ++i)
+                    symbols[t] = Symbol("test-Symbol-concurrent-" + std::to_string(i));
+            });
+
+        for (auto& thread : threads)
+            thread.join();
+
+        THEN("each name is interned once")
+        {
+            REQUIRE(table.size() == 100);
+            REQUIRE(symbols == std::vector<Symbol>(threadCount, symbols.front()));
+            REQUIRE(symbols.front() == "test-Symbol-concurrent-99");
+        }
+    }
+}
+
+SCENARIO("Well known symbols are constants", "[symbol]")
+{
+    GIVEN("a well known name")
+    {
+        THEN("a symbol of it is the constant")
+        {
+            REQUIRE(Symbol("annotation") == sym::annotation);
+            REQUIRE(Symbol("_version") == sym::version_);
+            REQUIRE(Symbol("") == Symbol());
+            REQUIRE(Symbol().empty());
+        }
+
+        THEN("it is found without creating a symbol")
+        {
+            REQUIRE(Symbol::find("annotation") == sym::annotation);
+            REQUIRE(Symbol::find(std::string("string")) == sym::string);
+        }
+
+        THEN("it is ordered before other names")
+        {
+            REQUIRE(sym::array < sym::string);
+            REQUIRE(sym::sourceMap < Symbol("a"));
+        }
+
+        THEN("reserved names are recognized")
+        {
+            REQUIRE(sym::isReserved(sym::string));
+            REQUIRE(sym::isReserved(sym::enum_));
+            REQUIRE(!sym::isReserved(sym::annotation));
+            REQUIRE(!sym::isReserved(Symbol("test-Symbol-unique-name")));
+        }
+    }
+}
+
+SCENARIO("Element names and info keys are symbols", "[symbol][Element]")
+{
+    auto e = from_primitive("value");
+
+    REQUIRE(e->element() == sym::string);
+
+    e->element("test-Symbol-named-type");
+    REQUIRE(e->element() == "test-Symbol-named-type");
+    REQUIRE(e->clone()->element() == e->element());
+
+    e->meta().set(sym::id, from_primitive("id"));
+    REQUIRE(e->meta().find("id") == e->meta().find(sym::id));
+    REQUIRE(e->meta().find(sym::id) != e->meta().end());
+}
@@ -84,7 +84,7 @@ TEST_CASE("It should invoke Functor for member of container elements", "[Visitor
     refract::Visitor v(f);
 
     auto e = make_element<ArrayElement>();
-    auto& content = e->get();
+    auto& content = e->mutate();
     content.push_back(from_primitive(3));
     content.push_back(from_primitive(false));
     content.push_back(from_primitive("Ehlo"));
@@ -122,7 +122,7 @@ struct Fixture {
     static std::unique_ptr<IElement> Complex()
     {
         auto result = make_element<ObjectElement>();
-        auto& content = result->get();
+        auto& content = result->mutate();
 
         {
             content.addMember("m1", from_primitive("Str1"));
@@ -131,7 +131,7 @@ struct Fixture {
         {
             auto arr = make_element<ArrayElement>();
             {
-                auto& c = arr->get();
+                auto& c = arr->mutate();
                 c.push_back(from_primitive("m2[0]"));
                 c.push_back(from_primitive(2));
             }
@@ -141,13 +141,13 @@ struct Fixture {
         {
             auto obj = make_element<ObjectElement>();
             {
-                auto& c = obj->get();
+                auto& c = obj->mutate();
                 c.addMember("m3.1", from_primitive("Str3.1"));
                 c.addMember("m3.2", from_primitive(3));
 
                 auto arr = make_element<ArrayElement>();
                 {
-                    auto& arrc = arr->get();
+                    auto& arrc = arr->mutate();
                     arrc.push_back(from_primitive("m[3][3][0]"));
                     arrc.push_back(from_primitive(false));
                 }
@@ -155,7 +155,7 @@ struct Fixture {
 
                 auto subObj = make_element<ObjectElement>();
                 {
-                    auto& subObjc = subObj->get();
+                    auto& subObjc = subObj->mutate();
                     subObjc.addMember("m3.4.1", from_primitive("Str3/4/1"));
                     subObjc.addMember("m3.4.2", from_primitive(3));
                     subObjc.addMember("m3.4.2", make_empty<NullElement>());
@@ -171,7 +171,7 @@ struct Fixture {
     static std::unique_ptr<IElement> SimpleObject()
     {
         auto result = make_element<ObjectElement>();
-        auto& content = result->get();
+        auto& content = result->mutate();
 
         content.addMember("m1", from_primitive("Str1"));
         content.addMember("m2", from_primitive("Str2"));
@@ -183,13 +183,13 @@ struct Fixture {
     static std::unique_ptr<IElement> ObjectWithChild()
     {
         auto result = make_element<ObjectElement>();
-        auto& content = result->get();
+        auto& content = result->mutate();
 
         content.addMember("m1", from_primitive("Str1"));
 
         auto child = make_element<ObjectElement>();
         {
-            auto& childc = child->get();
+            auto& childc = child->mutate();
             childc.addMember("m2.1", from_primitive("Str2/1"));
             childc.addMember("m2.2", make_empty<NullElement>());
         }
@@ -201,7 +201,7 @@ struct Fixture {
     static std::unique_ptr<IElement> SimpleArray()
     {
         auto result = make_element<ArrayElement>();
-        auto& content = result->get();
+        auto& content = result->mutate();
 
         content.push_back(from_primitive("1"));
         content.push_back(from_primitive(2));
@@ -213,13 +213,13 @@ struct Fixture {
     static std::unique_ptr<IElement> ArrayWithChild()
     {
         auto result = make_element<ArrayElement>();
-        auto& content = result->get();
+        auto& content = result->mutate();
 
         content.push_back(from_primitive("1"));
 
         auto child = make_element<ArrayElement>();
         {
-            auto& childc = child->get();
+            auto& childc = child->mutate();
             childc.push_back(from_primitive(1));
             childc.push_back(from_primitive(2));
         }
@@ -283,7 +283,7 @@ TEST_CASE("Iterate<Children> on string", "[Visitor]")
 TEST_CASE("Query Element name", "[Visitor]")
 {
     auto a = make_element<ArrayElement>();
-    auto& ac = a->get();
+    auto& ac = a->mutate();
 
     ac.push_back(from_primitive("str"));
 
@@ -65,6 +65,63 @@ int test_parse_to_string()
     return 0;
 };
 
+typedef struct {
+    char* data;
+    size_t size;
+    size_t chunks;
+} test_writer;
+
+size_t test_write(const char* data, size_t size, void* user_data)
+{
+    test_writer* writer = (test_writer*)user_data;
+
+    writer->data = (char*)realloc(writer->data, writer->size + size + 1);
+    memcpy(writer->data + writer->size, data, size);
+    writer->size += size;
+    writer->data[writer->size] = '\0';
+    writer->chunks++;
+
+    return size;
+}
+
+size_t test_write_fail(const char* data, size_t size, void* user_data)
+{
+    return 0;
+}
+
+int test_serialize_to()
+{
+    drafter_result* result = NULL;
+    drafter_parse_options parseOptions = { false };
+
+    int status = drafter_parse_blueprint(source, &result, parseOptions);
+
+    assert(status == 0);
+    assert(result);
+
+    drafter_serialize_options serializeOptions;
+    serializeOptions.sourcemap = true;
+    serializeOptions.format = DRAFTER_SERIALIZE_JSON;
+
+    char* out = drafter_serialize(result, serializeOptions);
+    assert(out);
+
+    test_writer writer = { NULL, 0, 0 };
+    assert(drafter_serialize_to(result, serializeOptions, test_write, &writer) == DRAFTER_OK);
+    assert(writer.chunks > 0);
+    assert(strcmp(out, writer.data) == 0);
+
+    assert(drafter_serialize_to(result, serializeOptions, test_write_fail, NULL) == DRAFTER_EINVALID_OUTPUT);
+    assert(drafter_serialize_to(result, serializeOptions, NULL, NULL) == DRAFTER_EINVALID_OUTPUT);
+    assert(drafter_serialize_to(NULL, serializeOptions, test_write, &writer) == DRAFTER_EINVALID_INPUT);
+
+    drafter_free_result(result);
+    free(writer.data);
+    free(out);
+
+    return 0;
+}
+
 int test_version()
 {
     assert(drafter_version() != 0);
@@ -103,6 +160,127 @@ int test_validation()
     return 0;
 }
 
+int test_parse_n()
+{
+    drafter_parse_options parseOptions = { false };
+    drafter_serialize_options options;
+    options.sourcemap = true;
+    options.format = DRAFTER_SERIALIZE_JSON;
+
+    /* source followed by garbage, no terminating NUL */
+    size_t len = strlen(source_warning);
+    char* buffer = (char*)malloc(len + 8);
+    memcpy(buffer, source_warning, len);
+    memset(buffer + len, '#', 8);
+
+    drafter_result* expected_result = NULL;
+    drafter_result* result = NULL;
+
+    assert(drafter_parse_blueprint(source_warning, &expected_result, parseOptions) == 0);
+    assert(drafter_parse_blueprint_n(buffer, len, &result, parseOptions) == 0);
+    assert(result);
+
+    char* expected_out = drafter_serialize(expected_result, options);
+    char* out = drafter_serialize(result, options);
+
+    assert(out && expected_out);
+    assert(strcmp(out, expected_out) == 0);
+
+    assert(drafter_parse_blueprint_n(NULL, 1, &result, parseOptions) == DRAFTER_EINVALID_INPUT);
+    assert(drafter_parse_blueprint_n(buffer, len, NULL, parseOptions) == DRAFTER_EINVALID_OUTPUT);
+
+    /* annotations of the source only */
+    drafter_result* checked = NULL;
+    assert(drafter_check_blueprint_n(buffer, len, &checked, parseOptions) == 0);
+    assert(checked);
+
+    drafter_free_result(checked);
+
+    drafter_free_result(expected_result);
+    drafter_free_result(result);
+    free(expected_out);
+    free(out);
+    free(buffer);
+
+    return 0;
+}
+
+const char* source_attributes = "# My API\n## GET /message\n+ Response 200 (application/json)\n"
+                                "    + Attributes\n        + message: Hello World (string)\n";
+
+int test_parse_stats()
+{
+    drafter_parse_options parseOptions = { false };
+    drafter_parse_stats stats;
+    drafter_result* result = NULL;
+
+    memset(&stats, 0, sizeof(stats));
+
+    assert(drafter_parse_blueprint_with_stats(
+               source_attributes, strlen(source_attributes), &result, parseOptions, &stats)
+        == 0);
+    assert(result);
+
+    assert(stats.expand_calls == 1);
+    assert(stats.json_bodies == 1);
+    assert(stats.json_schemas == 1);
+    assert(stats.elements > 0);
+    assert(stats.element_clones == 0);
+    assert(stats.total_ns >= stats.parse_ns + stats.register_ns + stats.refract_ns);
+    assert(stats.refract_ns >= stats.expand_ns + stats.json_body_ns + stats.json_schema_ns);
+
+    drafter_free_result(result);
+
+    /* statistics are optional */
+    assert(drafter_parse_blueprint_with_stats(source, strlen(source), &result, parseOptions, NULL) == 0);
+    assert(result);
+
+    drafter_free_result(result);
+
+    return 0;
+}
+
+int test_parse_with_options()
+{
+    drafter_parse_options parseOptions = { false };
+    drafter_conversion_options conversionOptions;
+    drafter_parse_stats stats;
+    drafter_result* result = NULL;
+
+    conversionOptions.size = sizeof(conversionOptions);
+    conversionOptions.threads = 4;
+
+    memset(&stats, 0, sizeof(stats));
+
+    assert(drafter_parse_blueprint_with_options(
+               source_attributes, strlen(source_attributes), &result, parseOptions, &conversionOptions, &stats)
+        == 0);
+    assert(result);
+
+    assert(stats.expand_calls == 1);
+    assert(stats.json_bodies == 1);
+    assert(stats.json_schemas == 1);
+
+    drafter_free_result(result);
+
+    /* options of an older header are ignored */
+    conversionOptions.size = sizeof(size_t);
+    assert(drafter_parse_blueprint_with_options(
+               source, strlen(source), &result, parseOptions, &conversionOptions, NULL)
+        == 0);
+    assert(result);
+
+    drafter_free_result(result);
+
+    /* conversion options are optional */
+    assert(drafter_parse_blueprint_with_options(source, strlen(source), &result, parseOptions, NULL, NULL) == 0);
+    assert(result);
+
+    drafter_free_result(result);
+
+    return 0;
+}
+
 const char* source_without_name = "# GET /\n+ Response 204\n";
 const char* expected_without_name = "expected API name, e.g. '# <API Name>'";
 
@@ -128,12 +306,61 @@ int test_parse_to_string_requiring_name()
     return 0;
 };
 
+int test_session()
+{
+    drafter_parse_options parseOptions = { false };
+    drafter_serialize_options options;
+    options.sourcemap = false;
+    options.format = DRAFTER_SERIALIZE_YAML;
+
+    int i;
+    drafter_session* session = drafter_session_new();
+    assert(session);
+
+    /* session is reusable, every parse yields the same result */
+    for (i = 0; i < 3; ++i) {
+        drafter_result* result = NULL;
+
+        int status = drafter_session_parse(session, source, &result, parseOptions);
+        assert(status == 0);
+        assert(result);
+
+        char* out = drafter_serialize(result, options);
+        assert(out);
+        assert(strncmp(out, expected, strlen(expected)) == 0);
+
+        drafter_free_result(result);
+        free(out);
+
+        result = NULL;
+        status = drafter_session_parse_n(session, source_warning, strlen(source_warning), &result, parseOptions);
+        assert(status == 0);
+        assert(result);
+
+        out = drafter_serialize(result, options);
+        assert(out);
+        assert(strstr(out, warning) != 0);
+
+        drafter_free_result(result);
+        free(out);
+    }
+
+    drafter_session_free(session);
+
+    return 0;
+}
+
 int main()
 {
     assert(test_parse_and_serialize() == 0);
     assert(test_parse_to_string() == 0);
+    assert(test_serialize_to() == 0);
+    assert(test_parse_n() == 0);
+    assert(test_parse_stats() == 0);
+    assert(test_parse_with_options() == 0);
     assert(test_version() == 0);
     assert(test_validation() == 0);
     assert(test_parse_to_string_requiring_name() == 0);
+    assert(test_session() == 0);
     return 0;
 }
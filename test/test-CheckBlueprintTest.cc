@@ -0,0 +1,158 @@
+//
+//  test-CheckBlueprintTest.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "draftertest.h"
+#include "BlueprintBuilder.h"
+
+#include "drafter.h"
+
+#include "refract/Element.h"
+#include "refract/FilterVisitor.h"
+#include "refract/Iterate.h"
+#include "refract/Query.h"
+
+using namespace draftertest;
+
+namespace
+{
+    const char* const fixtures[] = {
+        "test/fixtures/api/request-only",
+        "test/fixtures/api/schema-body",
+        "test/fixtures/circular/mixed",
+        "test/fixtures/circular/mixin-cross",
+        "test/fixtures/circular/mixin-identity",
+        "test/fixtures/mson/check-bool-number-value-validity",
+        "test/fixtures/mson/enum-multiple-default",
+        "test/fixtures/mson/mixin-nonexistent",
+        "test/fixtures/mson/resource-unresolved-reference",
+        "test/fixtures/mson/type-attributes-payload",
+        "test/fixtures/parse-result/blueprint",
+        "test/fixtures/parse-result/error-warning",
+        "test/fixtures/parse-result/error",
+        "test/fixtures/parse-result/simple",
+        "test/fixtures/parse-result/warnings",
+        "test/fixtures/render/issue-318",
+        "test/fixtures/render/numbers",
+        "test/fixtures/syntax/issue-350",
+    };
+
+    /// annotations of a full parse result, as drafter_check_blueprint() used to collect them
+    std::unique_ptr<refract::IElement> annotationsOf(const refract::IElement& result)
+    {
+        refract::FilterVisitor filter(refract::query::Element("annotation"));
+        refract::Iterate<refract::Children> iterate(filter);
+        iterate(result);
+
+        std::unique_ptr<refract::IElement> annotations;
+
+        if (!filter.empty()) {
+            refract::ArrayElement::ValueType elements;
+
+            for (const auto* annotation : filter.elements()) {
+                elements.push_back(annotation->clone());
+            }
+
+            annotations = std::make_unique<refract::ArrayElement>(std::move(elements));
+            annotations->element("parseResult");
+        }
+
+        return annotations;
+    }
+
+    std::unique_ptr<refract::IElement> fullParseAnnotations(const std::string& source, drafter_error& error)
+    {
+        drafter_result* result = nullptr;
+        error = drafter_parse_blueprint(source.c_str(), &result, drafter_parse_options{ false });
+        REQUIRE(result);
+
+        auto annotations = annotationsOf(*result);
+
+        drafter_free_result(result);
+
+        return annotations;
+    }
+
+    // named types inheriting from each other, with an invalid value, and
+    // resources responding with them
+    snowcrash::ParseResult<snowcrash::Blueprint> makeBlueprint()
+    {
+        snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+
+        auto types = category(snowcrash::Element::DataStructureGroupCategory);
+        auto resources = category(snowcrash::Element::ResourceGroupCategory);
+
+        for (int i = 0; i < 8; ++i) {
+            const std::string name = "T" + std::to_string(i);
+
+            types.content.elements().push_back(dataStructure(name, i ? "T" + std::to_string(i - 1) : ""));
+            addMember(types.content.elements().back(), "value" + std::to_string(i), mson::NumberTypeName, "n/a");
+
+            resources.content.elements().push_back(resource("/" + name, name));
+        }
+
+        blueprint.node.content.elements().push_back(types);
+        blueprint.node.content.elements().push_back(resources);
+
+        return blueprint;
+    }
+
+    std::string serialize(const refract::IElement& element)
+    {
+        std::ostringstream ss;
+        drafter::utils::so::serialize_json(ss, refract::serialize::renderSo(element, true));
+        return ss.str();
+    }
+}
+
+TEST_CASE("drafter_check_blueprint reports annotations of full parse", "[drafter][check]")
+{
+    for (const auto& fixture : fixtures) {
+        INFO("Fixture: " << fixture);
+
+        const std::string source = ITFixtureFiles(fixture).get(ext::apib);
+
+        drafter_error expectedError = DRAFTER_OK;
+        auto expected = fullParseAnnotations(source, expectedError);
+
+        drafter_result* result = nullptr;
+        REQUIRE(drafter_check_blueprint(source.c_str(), &result, drafter_parse_options{ false }) == expectedError);
+
+        if (!expected) {
+            REQUIRE(result == nullptr);
+            continue;
+        }
+
+        REQUIRE(result);
+        REQUIRE(serializeResult(result) == serializeResult(expected.get()));
+
+        drafter_free_result(result);
+    }
+}
+
+TEST_CASE("Validation reports annotations of payloads without generating their bodies", "[drafter][check]")
+{
+    const auto blueprint = makeBlueprint();
+
+    // small expansion limit, so expanding the payloads warns
+    auto full = blueprint;
+    drafter::ConversionContext fullContext("", drafter::WrapperOptions(false, false, false, 5));
+    auto expected = annotationsOf(*drafter::WrapRefract(full, fullContext));
+
+    auto checked = blueprint;
+    drafter::PipelineStats stats;
+    drafter::ConversionContext checkContext("", drafter::WrapperOptions(false, false, true, 5));
+    checkContext.stats = &stats;
+    auto result = drafter::WrapRefract(checked, checkContext);
+
+    REQUIRE(expected);
+    REQUIRE(serialize(*expected).find("named type 'T6' expands to more than 5 elements") != std::string::npos);
+    REQUIRE(serialize(*result) == serialize(*expected));
+
+    REQUIRE(stats.expandCalls > 0);
+    REQUIRE(stats.jsonBodies == 0);
+    REQUIRE(stats.jsonSchemas == 0);
+}
@@ -0,0 +1,121 @@
+//
+//  test-NamedTypesRegistry.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include <catch2/catch.hpp>
+
+#include "ConversionContext.h"
+#include "NamedTypesRegistry.h"
+#include "NodeInfo.h"
+#include "Serialize.h"
+
+#include "refract/Element.h"
+
+#include "BlueprintBuilder.h"
+
+using namespace draftertest;
+using namespace drafter;
+using namespace refract;
+
+namespace
+{
+    std::string typeName(size_t i)
+    {
+        return "T" + std::to_string(i);
+    }
+
+    void registerTypes(const snowcrash::Elements& elements, ConversionContext& context)
+    {
+        snowcrash::SourceMap<snowcrash::Elements> sourceMap;
+        sourceMap.collection.resize(elements.size());
+
+        RegisterNamedTypes(MakeNodeInfo(elements, sourceMap), context);
+    }
+
+    const IElement* memberValue(const IElement& object)
+    {
+        const auto& members = static_cast<const ObjectElement&>(object).get();
+        REQUIRE(members.size() == 1);
+
+        const auto& member = static_cast<const MemberElement&>(**members.begin());
+        return member.get().value();
+    }
+}
+
+SCENARIO("Named types are registered after types they depend on", "[registry]")
+{
+    const WrapperOptions options(false);
+
+    GIVEN("10000 named types defined before their base types and members")
+    {
+        const size_t count = 10000;
+
+        // T(i) inherits from T((i - 1) / 2), every tenth type has a member
+        // of the type defined right before it, T0 refers to the last one
+        snowcrash::Elements elements;
+        elements.reserve(count);
+
+        for (size_t i = count; i-- > 0;) {
+            elements.push_back(dataStructure(typeName(i), i == 0 ? std::string() : typeName((i - 1) / 2)));
+
+            if (i % 10 == 0)
+                addMember(elements.back(), "next", typeName(i == 0 ? count - 1 : i + 1));
+        }
+
+        WHEN("they are registered")
+        {
+            ConversionContext context("", options);
+            registerTypes(elements, context);
+
+            const auto& registry = context.GetNamedTypesRegistry();
+
+            THEN("all of them are registered with their base types")
+            {
+                for (size_t i = 1; i < count; ++i) {
+                    const IElement* type = registry.find(typeName(i));
+                    REQUIRE(type);
+                    REQUIRE(type->element() == typeName((i - 1) / 2));
+                }
+
+                REQUIRE(registry.find(typeName(0))->element() == "object");
+            }
+
+            THEN("members refer to registered types")
+            {
+                const IElement* next = memberValue(*registry.find(typeName(10)));
+                REQUIRE(next);
+                REQUIRE(next->element() == typeName(11));
+
+                const IElement* last = memberValue(*registry.find(typeName(0)));
+                REQUIRE(last);
+                REQUIRE(last->element() == typeName(count - 1));
+            }
+
+            THEN("no annotations are reported")
+            {
+                REQUIRE(context.warnings.empty());
+            }
+        }
+    }
+
+    GIVEN("named types inheriting from each other")
+    {
+        snowcrash::Elements elements;
+        elements.push_back(dataStructure("A", "B"));
+        elements.push_back(dataStructure("B", "C"));
+        elements.push_back(dataStructure("C", "A"));
+
+        WHEN("they are registered")
+        {
+            ConversionContext context("", options);
+
+            THEN("the circular inheritance is reported as an error")
+            {
+                REQUIRE_THROWS_AS(registerTypes(elements, context), snowcrash::Error);
+            }
+        }
+    }
+}
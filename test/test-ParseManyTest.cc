@@ -0,0 +1,158 @@
+//
+//  test-ParseManyTest.cc
+//  drafter
+//
+//  Copyright (c) 2026 Apiary Inc. All rights reserved.
+//
+
+#include "draftertest.h"
+
+#include "drafter.h"
+
+#include <cstdlib>
+#include <thread>
+
+using namespace draftertest;
+
+namespace
+{
+    const char* const fixtures[] = {
+        "test/fixtures/api/mson",
+        "test/fixtures/api/data-structure",
+        "test/fixtures/api/attributes-references",
+        "test/fixtures/api/schema-body",
+        "test/fixtures/parse-result/blueprint",
+        "test/fixtures/parse-result/error-warning",
+        "test/fixtures/parse-result/warnings",
+        "test/fixtures/circular/cross",
+        "test/fixtures/extend/complex",
+        "test/fixtures/schema/array-fixed-inline-samples",
+    };
+
+    std::vector<std::string> loadSources(size_t copies)
+    {
+        std::vector<std::string> sources;
+
+        for (size_t i = 0; i < copies; ++i) {
+            for (const auto& fixture : fixtures) {
+                sources.push_back(ITFixtureFiles(fixture).get(ext::apib));
+            }
+        }
+
+        return sources;
+    }
+}
+
+TEST_CASE("drafter_parse_many results match drafter_parse_blueprint", "[drafter][parse_many]")
+{
+    const auto sources = loadSources(8);
+    const drafter_parse_options options{ false };
+
+    std::vector<std::string> expected;
+    std::vector<drafter_error> expectedErrors;
+
+    for (const auto& source : sources) {
+        drafter_result* result = nullptr;
+        expectedErrors.push_back(drafter_parse_blueprint(source.c_str(), &result, options));
+
+        REQUIRE(result);
+        expected.push_back(serializeResult(result));
+        drafter_free_result(result);
+    }
+
+    std::vector<const char*> input;
+    for (const auto& source : sources) {
+        input.push_back(source.c_str());
+    }
+
+    std::vector<drafter_result*> results(input.size(), nullptr);
+    std::vector<drafter_error> errors(input.size(), DRAFTER_EUNKNOWN);
+
+    drafter_parse_many(input.data(), input.size(), 8, results.data(), errors.data(), options);
+
+    for (size_t i = 0; i < input.size(); ++i) {
+        INFO("Source: " << i);
+        REQUIRE(results[i]);
+        REQUIRE(errors[i] == expectedErrors[i]);
+        REQUIRE(serializeResult(results[i]) == expected[i]);
+
+        drafter_free_result(results[i]);
+    }
+}
+
+TEST_CASE("drafter_parse_many aggregates errors", "[drafter][parse_many]")
+{
+    const drafter_parse_options options{ false };
+    const char* input[] = { "# API\n", nullptr, "# API\n" };
+
+    drafter_result* results[3] = {};
+    drafter_error errors[3] = {};
+
+    REQUIRE(drafter_parse_many(input, 3, 2, results, errors, options) == DRAFTER_EINVALID_INPUT);
+
+    REQUIRE(errors[0] == DRAFTER_OK);
+    REQUIRE(errors[1] == DRAFTER_EINVALID_INPUT);
+    REQUIRE(errors[2] == DRAFTER_OK);
+
+    REQUIRE(results[0]);
+    REQUIRE(results[1] == nullptr);
+    REQUIRE(results[2]);
+
+    drafter_free_result(results[0]);
+    drafter_free_result(results[2]);
+
+    REQUIRE(drafter_parse_many(nullptr, 0, 0, nullptr, nullptr, options) == DRAFTER_OK);
+    REQUIRE(drafter_parse_many(nullptr, 1, 0, results, nullptr, options) == DRAFTER_EINVALID_INPUT);
+    REQUIRE(drafter_parse_many(input, 1, 0, nullptr, nullptr, options) == DRAFTER_EINVALID_OUTPUT);
+}
+
+// Run under ThreadSanitizer to verify the library is reentrant
+TEST_CASE("Sessions and serialization are safe to use from concurrent threads", "[drafter][parse_many]")
+{
+    const auto sources = loadSources(1);
+    const drafter_parse_options options{ false };
+
+    std::vector<std::string> expected;
+    for (const auto& source : sources) {
+        drafter_result* result = nullptr;
+        drafter_parse_blueprint(source.c_str(), &result, options);
+        expected.push_back(serializeResult(result));
+        drafter_free_result(result);
+    }
+
+    const size_t threadCount = 8;
+    std::vector<size_t> mismatches(threadCount, 0);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            drafter_session* session = drafter_session_new();
+            drafter_serialize_options serializeOptions{ true, DRAFTER_SERIALIZE_JSON };
+
+            for (size_t round = 0; round < 4; ++round) {
+                for (size_t i = 0; i < sources.size(); ++i) {
+                    drafter_result* result = nullptr;
+                    drafter_session_parse(session, sources[(i + t) % sources.size()].c_str(), &result, options);
+
+                    char* out = drafter_serialize(result, serializeOptions);
+                    if (!out || expected[(i + t) % sources.size()] != out)
+                        ++mismatches[t];
+
+                    free(out);
+                    drafter_free_result(result);
+                }
+            }
+
+            drafter_session_free(session);
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t t = 0; t < threadCount; ++t) {
+        INFO("Thread: " << t);
+        REQUIRE(mismatches[t] == 0);
+    }
+}
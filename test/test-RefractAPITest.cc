@@ -1,6 +1,10 @@
 #include "draftertest.h"
+#include "BlueprintBuilder.h"
 
 using namespace draftertest;
+using namespace drafter;
+using namespace refract;
+using namespace drafter::utils;
 
 TEST_REFRACT("api", "description");
 TEST_REFRACT("api", "metadata");
@@ -35,3 +39,116 @@ TEST_REFRACT("api", "attributes-named-type-mixin");
 TEST_REFRACT("api", "attributes-named-type-enum-reference");
 
 TEST_REFRACT("api", "mixin-inheritance");
+
+namespace
+{
+    // groups of named types inheriting from each other, each with an invalid
+    // value, and resources responding with them
+    snowcrash::ParseResult<snowcrash::Blueprint> makeBlueprint()
+    {
+        snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+        auto& elements = blueprint.node.content.elements();
+
+        for (int group = 0; group < 8; ++group) {
+            auto types = category(snowcrash::Element::DataStructureGroupCategory);
+            auto resources = category(snowcrash::Element::ResourceGroupCategory);
+            resources.content.elements().push_back(copy("Group " + std::to_string(group)));
+
+            for (int i = 0; i < 8; ++i) {
+                const std::string name = "T" + std::to_string(group) + "_" + std::to_string(i);
+                const std::string parent = i ? "T" + std::to_string(group) + "_" + std::to_string(i - 1) : "";
+
+                types.content.elements().push_back(dataStructure(name, parent));
+                addMember(types.content.elements().back(), "value" + std::to_string(i), mson::NumberTypeName, "n/a");
+
+                resources.content.elements().push_back(resource("/" + name, name));
+            }
+
+            elements.push_back(types);
+            elements.push_back(resources);
+        }
+
+        return blueprint;
+    }
+
+    std::string convert(
+        snowcrash::ParseResult<snowcrash::Blueprint> blueprint, size_t threads, PipelineStats* stats = nullptr)
+    {
+        // small expansion limit, so every deep enough named type is reported
+        const WrapperOptions options(false, true, false, 5, threads);
+        ConversionContext context("", options);
+        context.stats = stats;
+        auto result = WrapRefract(blueprint, context);
+
+        std::ostringstream ss;
+        so::serialize_json(ss, serialize::renderSo(*result, false), so::packed{});
+        return ss.str();
+    }
+}
+
+SCENARIO("Concurrent conversion gives the same result as serial one", "[refract][threads]")
+{
+    GIVEN("a blueprint with several groups of data structures and resources")
+    {
+        const auto blueprint = makeBlueprint();
+
+        WHEN("it is converted serially and concurrently")
+        {
+            const std::string serial = convert(blueprint, 1);
+            const std::string concurrent = convert(blueprint, 4);
+
+            THEN("the results including warnings are identical")
+            {
+                REQUIRE(serial.find("invalid value format for 'number' type") != std::string::npos);
+                REQUIRE(serial.find("named type 'T7_6' expands to more than 5 elements") != std::string::npos);
+                REQUIRE(serial.find("messageBody") != std::string::npos);
+                REQUIRE(serial.find("messageBodySchema") != std::string::npos);
+                REQUIRE(concurrent == serial);
+            }
+        }
+
+        WHEN("it is converted concurrently")
+        {
+            const WrapperOptions options(false, true, false, 5, 4);
+            ConversionContext context("", options);
+            auto copy = blueprint;
+            auto result = WrapRefract(copy, context);
+
+            THEN("names of its named types are interned once in the table of the context")
+            {
+                const auto& table = *context.GetSymbolTable();
+                const size_t interned = table.size();
+                REQUIRE(interned >= 64);
+
+                SymbolScope scope(*context.GetSymbolTable());
+                REQUIRE(Symbol("T7_6") == "T7_6");
+                REQUIRE(table.size() == interned);
+            }
+        }
+
+        WHEN("stats are collected while it is converted serially and concurrently")
+        {
+            PipelineStats serial;
+            PipelineStats concurrent;
+
+            convert(blueprint, 1, &serial);
+            convert(blueprint, 4, &concurrent);
+
+            THEN("work done by all threads is counted")
+            {
+                REQUIRE(serial.expandCalls > 0);
+                REQUIRE(serial.jsonBodies == 64);
+                REQUIRE(serial.jsonSchemas == 64);
+
+                REQUIRE(concurrent.expandCalls == serial.expandCalls);
+                REQUIRE(concurrent.jsonBodies == serial.jsonBodies);
+                REQUIRE(concurrent.jsonSchemas == serial.jsonSchemas);
+
+                // forked contexts expand named types on their own
+                REQUIRE(serial.expand.clones.elements > 0);
+                REQUIRE(concurrent.expand.clones.elements >= serial.expand.clones.elements);
+                REQUIRE(concurrent.refract.clones.elements >= concurrent.expand.clones.elements);
+            }
+        }
+    }
+}